@@ -0,0 +1,89 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/binary.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/ostream.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+struct price : opaque::numeric_typedef<std::int64_t, price> {
+  using base = opaque::numeric_typedef<std::int64_t, price>;
+  using base::base;
+};
+
+struct quantity : opaque::numeric_typedef<std::int64_t, quantity> {
+  using base = opaque::numeric_typedef<std::int64_t, quantity>;
+  using base::base;
+};
+
+struct fill {
+  price    px;
+  quantity qty;
+};
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 2000000);
+  std::vector<fill> fills;
+  for (std::size_t i = 0; i < n; ++i) {
+    fills.push_back({ price(static_cast<std::int64_t>(i * 7919)),
+                      quantity(static_cast<std::int64_t>(i % 1000)) });
+  }
+
+  std::string text, raw;
+  measure("ostream operator<< write", n, [&] {
+    std::ostringstream os;
+    for (const auto& f : fills) os << f.px << ' ' << f.qty << '\n';
+    text = os.str();
+  });
+  measure("ostream operator>> read", n, [&] {
+    std::istringstream is(text);
+    std::vector<fill> back(n);
+    for (auto& f : back) is >> f.px.value >> f.qty.value;
+    keep(back.back());
+  });
+  measure("binary write", n, [&] {
+    std::ostringstream os;
+    opaque::binary::write(os, std::span<const fill>(fills));
+    raw = os.str();
+  });
+  measure("binary read", n, [&] {
+    std::istringstream is(raw);
+    std::vector<fill> back;
+    opaque::binary::read(is, back);
+    keep(back.back());
+  });
+  std::vector<std::byte> buf(opaque::binary::encoded_size<fill>(n));
+  measure("binary encode to buffer", n, [&] {
+    keep(opaque::binary::encode(std::span<const fill>(fills),
+          std::span(buf)).size());
+  });
+  std::printf("text %zu bytes, binary %zu bytes\n", text.size(), raw.size());
+}
@@ -0,0 +1,346 @@
+#ifndef OPAQUE_BINARY_HPP
+#define OPAQUE_BINARY_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/hash.hpp"
+#include "opaque/storage.hpp"
+#include <bit>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#if __has_include(<sys/uio.h>) and __has_include(<unistd.h>)
+#include <sys/uio.h>
+#include <unistd.h>
+#define OPAQUE_BINARY_HAS_WRITEV 1
+#endif
+
+namespace opaque {
+namespace binary {
+
+/// \addtogroup miscellaneous
+/// @{
+
+//
+// Raw binary serialization of trivially copyable types
+//
+// A record is a fixed header followed by the elements' object
+// representations, copied directly from and to memory.  The header carries
+// a schema hash of the element type, so a reader expecting a different
+// type, layout or byte order fails immediately instead of misreading.
+//
+// Records are meant for checkpoints read back by the same program on the
+// same platform.  Use endian_typedef fields for data exchanged between
+// platforms.
+//
+
+/// A record could not be read
+struct error : std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+
+/// A record was written for a different type than the reader expects
+struct schema_mismatch : error {
+  using error::error;
+};
+
+///
+/// Types whose object representation can be serialized directly
+///
+/// Pointers are excluded, since their values are meaningless when read back.
+///
+template <typename T>
+concept serializable = std::is_trivially_copyable_v<T>
+  and not std::is_pointer_v<T> and not std::is_member_pointer_v<T>;
+
+///
+/// Name of a type as spelled by the compiler
+///
+/// Intended only for hashing; the spelling differs between compilers.
+///
+template <typename T>
+constexpr std::string_view type_name() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __PRETTY_FUNCTION__;
+#elif defined(_MSC_VER)
+  return __FUNCSIG__;
+#else
+  return "";
+#endif
+}
+
+///
+/// Hash identifying the serialized form of T
+///
+/// This covers the name of T, the name of its underlying type if it is an
+/// opaque typedef, its size and alignment, and the native byte order.  It
+/// cannot see the members of a struct, so change the struct name (or add a
+/// version to it) when its members change.
+///
+template <typename T>
+constexpr std::uint64_t schema_hash() noexcept {
+  std::uint64_t h = hash_policy::salt_of(type_name<T>());
+  if constexpr (std::is_base_of_v<opaque_tag, T>) {
+    h = opaque::detail::mix64(h ^ hash_policy::salt_of(
+          type_name<typename T::underlying_type>()));
+  }
+  h = opaque::detail::mix64(h ^ (std::uint64_t{sizeof(T)} << 32) ^ alignof(T));
+  return opaque::detail::mix64(
+      h ^ std::uint64_t{std::endian::native == std::endian::big});
+}
+
+///
+/// Fixed header preceding the elements of a record
+///
+struct header {
+  static constexpr std::uint64_t expected_magic = 0x3142515041504f00u;
+
+  std::uint64_t magic;
+  std::uint64_t schema;
+  std::uint64_t count;
+
+  template <typename T>
+  static constexpr header of(std::size_t count) noexcept {
+    return { expected_magic, schema_hash<T>(), count };
+  }
+
+  /// Check that this header introduces a record of T
+  template <typename T>
+  void check() const {
+    if (magic != expected_magic) {
+      throw error("opaque::binary: not a record");
+    }
+    if (schema != schema_hash<T>()) {
+      throw schema_mismatch("opaque::binary: schema mismatch");
+    }
+  }
+};
+
+static_assert(std::is_trivially_copyable_v<header> and sizeof(header) == 24);
+
+//
+// Memory buffers
+//
+
+/// Bytes needed for a record of n elements of T
+template <serializable T>
+constexpr std::size_t encoded_size(std::size_t n) noexcept {
+  return sizeof(header) + n * sizeof(T);
+}
+
+///
+/// Encode a record into a buffer, returning the unused tail
+///
+/// Throws std::length_error if the buffer is too small.
+///
+template <serializable T>
+std::span<std::byte> encode(std::span<const T> in, std::span<std::byte> out) {
+  const std::size_t size = encoded_size<T>(in.size());
+  if (out.size() < size) throw std::length_error("opaque::binary::encode");
+  const header h = header::of<T>(in.size());
+  std::memcpy(out.data(), &h, sizeof(h));
+  if (not in.empty()) {
+    std::memcpy(out.data() + sizeof(h), in.data(), in.size_bytes());
+  }
+  return out.subspan(size);
+}
+
+///
+/// Decode a record from a buffer, appending its elements to a vector
+///
+/// Returns the unconsumed tail of the buffer.
+///
+template <serializable T>
+std::span<const std::byte> decode(std::span<const std::byte> in,
+    std::vector<T>& out) {
+  header h;
+  if (in.size() < sizeof(h)) throw error("opaque::binary: truncated header");
+  std::memcpy(&h, in.data(), sizeof(h));
+  h.check<T>();
+  if ((in.size() - sizeof(h)) / sizeof(T) < h.count) {
+    throw error("opaque::binary: truncated record");
+  }
+  const std::size_t old = out.size();
+  out.resize(old + h.count);
+  if (h.count) {
+    std::memcpy(out.data() + old, in.data() + sizeof(h), h.count * sizeof(T));
+  }
+  return in.subspan(encoded_size<T>(h.count));
+}
+
+//
+// Streams
+//
+// Stream errors are reported by throwing binary::error, whatever the
+// exception mask of the stream.
+//
+
+/// Write a record of the elements of a span
+template <serializable T>
+void write(std::ostream& os, std::span<const T> in) {
+  const header h = header::of<T>(in.size());
+  os.write(reinterpret_cast<const char *>(&h), sizeof(h));
+  os.write(reinterpret_cast<const char *>(in.data()),
+      static_cast<std::streamsize>(in.size_bytes()));
+  if (not os) throw error("opaque::binary: write failed");
+}
+
+/// Write a record of a single value
+template <serializable T>
+void write(std::ostream& os, const T& value) {
+  write(os, std::span<const T>(&value, 1));
+}
+
+/// Read a record, appending its elements to a vector
+template <serializable T>
+void read(std::istream& is, std::vector<T>& out) {
+  header h;
+  if (not is.read(reinterpret_cast<char *>(&h), sizeof(h))) {
+    throw error("opaque::binary: truncated header");
+  }
+  h.check<T>();
+  const std::size_t old = out.size();
+  // Grow in bounded steps, so a corrupt count cannot demand huge memory
+  constexpr std::size_t step = (std::size_t{1} << 24) / sizeof(T) + 1;
+  for (std::size_t left = h.count; left; ) {
+    const std::size_t n = left < step ? left : step;
+    const std::size_t at = out.size();
+    out.resize(at + n);
+    if (not is.read(reinterpret_cast<char *>(out.data() + at),
+          static_cast<std::streamsize>(n * sizeof(T)))) {
+      out.resize(old);
+      throw error("opaque::binary: truncated record");
+    }
+    left -= n;
+  }
+}
+
+/// Read a record of exactly one value
+template <serializable T>
+T read(std::istream& is) {
+  std::vector<T> v;
+  read(is, v);
+  if (v.size() != 1) throw error("opaque::binary: expected one value");
+  return v.front();
+}
+
+#if defined(OPAQUE_BINARY_HAS_WRITEV)
+
+//
+// POSIX file descriptors
+//
+// The header and elements are written with one writev call, and read
+// directly into the destination, without intermediate buffering.  System
+// call failures throw std::system_error.
+//
+
+/// Write a record of the elements of a span
+template <serializable T>
+void write(int fd, std::span<const T> in) {
+  const header h = header::of<T>(in.size());
+  iovec iov[2] = {
+    { const_cast<header *>(&h), sizeof(h) },
+    { const_cast<T *>(in.data()), in.size_bytes() },
+  };
+  int first = 0;
+  while (first < 2) {
+    const ssize_t n = ::writev(fd, iov + first, 2 - first);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(),
+          "opaque::binary::write");
+    }
+    auto done = static_cast<std::size_t>(n);
+    while (first < 2 and done >= iov[first].iov_len) {
+      done -= iov[first++].iov_len;
+    }
+    if (first < 2) {
+      iov[first].iov_base = static_cast<char *>(iov[first].iov_base) + done;
+      iov[first].iov_len -= done;
+    }
+  }
+}
+
+namespace detail {
+
+inline void read_fully(int fd, void * p, std::size_t len) {
+  auto * bytes = static_cast<char *>(p);
+  while (len) {
+    const ssize_t n = ::read(fd, bytes, len);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      throw std::system_error(errno, std::generic_category(),
+          "opaque::binary::read");
+    }
+    if (n == 0) throw error("opaque::binary: truncated record");
+    bytes += n;
+    len -= static_cast<std::size_t>(n);
+  }
+}
+
+}
+
+/// Read a record, appending its elements to a vector
+template <serializable T>
+void read(int fd, std::vector<T>& out) {
+  header h;
+  detail::read_fully(fd, &h, sizeof(h));
+  h.check<T>();
+  const std::size_t old = out.size();
+  constexpr std::size_t step = (std::size_t{1} << 24) / sizeof(T) + 1;
+  try {
+    for (std::size_t left = h.count; left; ) {
+      const std::size_t n = left < step ? left : step;
+      const std::size_t at = out.size();
+      out.resize(at + n);
+      detail::read_fully(fd, out.data() + at, n * sizeof(T));
+      left -= n;
+    }
+  } catch (...) {
+    out.resize(old);
+    throw;
+  }
+}
+
+#endif
+
+/// @}
+
+}
+}
+
+#endif
@@ -0,0 +1,145 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/binary.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+struct price : opaque::numeric_typedef<std::int64_t, price> {
+  using base = opaque::numeric_typedef<std::int64_t, price>;
+  using base::base;
+};
+
+struct quantity : opaque::numeric_typedef<std::int64_t, quantity> {
+  using base = opaque::numeric_typedef<std::int64_t, quantity>;
+  using base::base;
+};
+
+struct quantity32 : opaque::numeric_typedef<std::int32_t, quantity32> {
+  using base = opaque::numeric_typedef<std::int32_t, quantity32>;
+  using base::base;
+};
+
+struct fill {
+  price    px;
+  quantity qty;
+};
+
+namespace bin = opaque::binary;
+
+static_assert(bin::serializable<price>);
+static_assert(bin::serializable<fill>);
+static_assert(not bin::serializable<int *>);
+static_assert(not bin::serializable<std::vector<int>>);
+static_assert(bin::schema_hash<price>() == bin::schema_hash<price>());
+static_assert(bin::schema_hash<price>() != bin::schema_hash<quantity>());
+static_assert(bin::schema_hash<quantity>() != bin::schema_hash<quantity32>());
+static_assert(bin::schema_hash<price>() != bin::schema_hash<std::int64_t>());
+
+TEST(stream) {
+  std::vector<fill> fills;
+  for (int i = 0; i < 1000; ++i) fills.push_back({ price(i * 3), quantity(i) });
+  std::stringstream ss;
+  bin::write(ss, std::span<const fill>(fills));
+  bin::write(ss, price(42));
+  CHECK_EQUAL(bin::encoded_size<fill>(1000) + bin::encoded_size<price>(1),
+      ss.str().size());
+  std::vector<fill> back;
+  bin::read(ss, back);
+  CHECK_EQUAL(fills.size(), back.size());
+  CHECK(back[999].px == price(2997) and back[999].qty == quantity(999));
+  CHECK(bin::read<price>(ss) == price(42));
+}
+
+TEST(mismatch) {
+  std::stringstream ss;
+  bin::write(ss, price(1));
+  try {
+    bin::read<quantity>(ss);
+    CHECK_CATCH(bin::schema_mismatch, e);
+  }
+  std::stringstream junk("not a record at all, just some text");
+  try {
+    bin::read<price>(junk);
+    CHECK_CATCH(bin::error, e);
+  }
+  std::stringstream empty;
+  try {
+    bin::read<price>(empty);
+    CHECK_CATCH(bin::error, e);
+  }
+}
+
+TEST(buffer) {
+  const price prices[] = { price(1), price(2), price(3) };
+  std::vector<std::byte> buf(bin::encoded_size<price>(3) + 5);
+  const auto tail = bin::encode(std::span<const price>(prices), std::span(buf));
+  CHECK_EQUAL(5u, tail.size());
+  std::vector<price> out;
+  const auto rest = bin::decode(std::span<const std::byte>(buf), out);
+  CHECK_EQUAL(5u, rest.size());
+  CHECK_EQUAL(3u, out.size());
+  CHECK(out[2] == price(3));
+  try {
+    bin::decode(std::span<const std::byte>(buf).first(30), out);
+    CHECK_CATCH(bin::error, e);
+  }
+  CHECK_EQUAL(3u, out.size());
+  try {
+    bin::encode(std::span<const price>(prices), std::span(buf).first(20));
+    CHECK_CATCH(std::length_error, e);
+  }
+}
+
+#if defined(OPAQUE_BINARY_HAS_WRITEV)
+TEST(descriptor) {
+  std::FILE * f = std::tmpfile();
+  CHECK(f != nullptr);
+  if (not f) return;
+  const int fd = fileno(f);
+  std::vector<quantity> q;
+  for (int i = 0; i < 100000; ++i) q.push_back(quantity(i));
+  bin::write(fd, std::span<const quantity>(q));
+  lseek(fd, 0, SEEK_SET);
+  std::vector<quantity> back;
+  bin::read(fd, back);
+  CHECK(q == back);
+  try {
+    bin::read(fd, back);
+    CHECK_CATCH(bin::error, e);
+  }
+  CHECK_EQUAL(q.size(), back.size());
+  std::fclose(f);
+}
+#endif
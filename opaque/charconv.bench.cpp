@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/charconv.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/string_typedef.hpp"
+#include "opaque/ostream.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+struct order_id : opaque::numeric_typedef<std::uint64_t, order_id> {
+  using base = opaque::numeric_typedef<std::uint64_t, order_id>;
+  using base::base;
+};
+
+struct ratio : opaque::numeric_typedef<double, ratio> {
+  using base = opaque::numeric_typedef<double, ratio>;
+  using base::base;
+};
+
+struct symbol : opaque::experimental::string_typedef<std::string, symbol> {
+  using base = opaque::experimental::string_typedef<std::string, symbol>;
+  using base::base;
+};
+
+template <typename T>
+void run(const char * name, const std::vector<T>& values) {
+  const std::size_t n = values.size();
+  char label[128];
+  std::snprintf(label, sizeof(label), "%s ostream", name);
+  measure(label, n, [&] {
+    std::ostringstream os;
+    for (const auto& v : values) os << v << '\n';
+    keep(os.tellp());
+  });
+  std::snprintf(label, sizeof(label), "%s to_chars", name);
+  measure(label, n, [&] {
+    char buf[64];
+    std::size_t total = 0;
+    for (const auto& v : values) {
+      total += opaque::format_to_buffer(buf, v).size();
+    }
+    keep(total);
+  });
+  std::snprintf(label, sizeof(label), "%s format_span", name);
+  measure(label, n, [&] {
+    static char buf[1 << 16];
+    std::size_t total = 0;
+    for (std::span<const T> rest(values); not rest.empty(); ) {
+      const auto r = opaque::format_span(rest, std::span(buf));
+      total += r.size;
+      rest = rest.subspan(r.values);
+    }
+    keep(total);
+  });
+}
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 2000000);
+  std::mt19937_64 rng(9);
+  std::vector<order_id> ids;
+  std::vector<ratio> ratios;
+  std::vector<symbol> symbols;
+  const char * names[] = { "AAPL", "MSFT", "GOOGL", "BRK.B", "V", "NVDA" };
+  for (std::size_t i = 0; i < n; ++i) {
+    ids.emplace_back(rng() >> (rng() % 48));
+    ratios.emplace_back(static_cast<double>(rng() % 1000000) / 1000.0);
+    symbols.emplace_back(names[rng() % 6]);
+  }
+  run("integer", ids);
+  run("double", ratios);
+  run("string", symbols);
+
+  // Parsing the second column of a three-column CSV
+  std::string csv;
+  for (std::size_t i = 0; i < n; ++i) {
+    csv += std::to_string(i) + ',' + std::to_string(ids[i].value) + ',' +
+      names[i % 6] + '\n';
+  }
+  measure("parse column istream", n, [&] {
+    std::istringstream is(csv);
+    std::vector<order_id> out;
+    std::string line;
+    while (std::getline(is, line)) {
+      std::istringstream fields(line);
+      std::string field;
+      std::getline(fields, field, ',');
+      std::uint64_t v;
+      fields >> v;
+      out.emplace_back(v);
+    }
+    keep(out.size());
+  });
+  measure("parse_column", n, [&] {
+    std::vector<order_id> out;
+    opaque::parse_column(csv, out, 1);
+    keep(out.size());
+  });
+}
@@ -0,0 +1,286 @@
+#ifndef OPAQUE_CHARCONV_HPP
+#define OPAQUE_CHARCONV_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/storage.hpp"
+#include "opaque/simd.hpp"
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+template <typename U>
+concept char_string = requires(const U& u) {
+  { u.data() } -> std::convertible_to<const char *>;
+  { u.size() } -> std::convertible_to<std::size_t>;
+};
+
+template <typename U>
+concept chars_value = (std::is_arithmetic_v<U> or char_string<U>)
+  and not std::is_base_of_v<opaque_tag, U>;
+
+template <typename U, typename... Args>
+std::to_chars_result to_chars_value(char * first, char * last, const U& u,
+    Args... args) {
+  if constexpr (char_string<U>) {
+    static_assert(sizeof...(Args) == 0, "strings take no format arguments");
+    const std::size_t n = u.size();
+    if (static_cast<std::size_t>(last - first) < n) {
+      return { last, std::errc::value_too_large };
+    }
+    if (n) std::memcpy(first, u.data(), n);
+    return { first + n, std::errc() };
+  } else if constexpr (std::is_same_v<U, bool> or std::is_same_v<U, char>) {
+    // Written as operator<< would: bool as 0 or 1, char as itself
+    static_assert(sizeof...(Args) == 0);
+    if (first == last) return { last, std::errc::value_too_large };
+    *first = std::is_same_v<U, bool> ? static_cast<char>('0' + u) : char(u);
+    return { first + 1, std::errc() };
+  } else {
+    return std::to_chars(first, last, u, args...);
+  }
+}
+
+template <typename U, typename... Args>
+std::from_chars_result from_chars_value(const char * first, const char * last,
+    U& u, Args... args) {
+  if constexpr (char_string<U>) {
+    static_assert(sizeof...(Args) == 0, "strings take no format arguments");
+    u = U(first, static_cast<std::size_t>(last - first));
+    return { last, std::errc() };
+  } else if constexpr (std::is_same_v<U, bool> or std::is_same_v<U, char>) {
+    static_assert(sizeof...(Args) == 0);
+    if (first == last or (std::is_same_v<U, bool> and
+          *first != '0' and *first != '1')) {
+      return { first, std::errc::invalid_argument };
+    }
+    u = std::is_same_v<U, bool> ? U(*first == '1') : U(*first);
+    return { first + 1, std::errc() };
+  } else {
+    return std::from_chars(first, last, u, args...);
+  }
+}
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+//
+// Text formatting without streams
+//
+// These write the value of an opaque typedef directly into a character
+// buffer: no locale, no stream state, no allocation.  Numbers use
+// std::to_chars and strings are copied.  Most integers, bool, char and
+// strings come out as operator<< in opaque/ostream.hpp writes them.  The
+// exceptions are signed char and unsigned char (std::int8_t and
+// std::uint8_t), which operator<< writes as characters but these write as
+// numbers, so that from_chars reads them back.  Floating-point values take
+// the shortest form that reads back exactly, rather than the six
+// significant digits of a default stream.
+//
+
+/// Opaque typedefs whose value can be written by opaque::to_chars
+template <typename O>
+concept chars_formattable = std::is_base_of_v<opaque_tag, O>
+  and detail::chars_value<typename O::underlying_type>;
+
+///
+/// Write the value of an opaque typedef, in the manner of std::to_chars
+///
+/// Extra arguments (an integer base, or a floating-point format and
+/// precision) are passed on to std::to_chars.
+///
+template <chars_formattable O, typename... Args>
+std::to_chars_result to_chars(char * first, char * last, const O& value,
+    Args... args) {
+  return detail::to_chars_value(first, last, value.value, args...);
+}
+
+///
+/// Write the value of an opaque typedef into a buffer
+///
+/// Returns the text written; throws std::length_error if it does not fit.
+///
+template <chars_formattable O, typename... Args>
+std::string_view format_to_buffer(std::span<char> buffer, const O& value,
+    Args... args) {
+  char * const first = buffer.data();
+  const auto r = opaque::to_chars(first, first + buffer.size(), value,
+      args...);
+  if (r.ec != std::errc()) {
+    throw std::length_error("opaque::format_to_buffer");
+  }
+  return { first, static_cast<std::size_t>(r.ptr - first) };
+}
+
+struct format_span_result {
+  std::size_t values; ///< Number of values written
+  std::size_t size;   ///< Number of characters written
+};
+
+///
+/// Write a sequence of values, each followed by a separator, into a buffer
+///
+/// Writing stops before the first value that does not fit, so the buffer
+/// always ends with a complete value and its separator.  Continue with the
+/// remaining values and a fresh buffer.
+///
+template <typename O> requires chars_formattable<std::remove_const_t<O>>
+format_span_result format_span(std::span<O> values, std::span<char> buffer,
+    char separator = '\n') {
+  char * p = buffer.data();
+  char * const last = p + buffer.size();
+  std::size_t i = 0;
+  for (; i < values.size(); ++i) {
+    const auto r = opaque::to_chars(p, last, values[i]);
+    if (r.ec != std::errc() or r.ptr == last) break;
+    *r.ptr = separator;
+    p = r.ptr + 1;
+  }
+  return { i, static_cast<std::size_t>(p - buffer.data()) };
+}
+
+//
+// Parsing text
+//
+// from_chars reads the underlying value as std::from_chars does, then
+// creates the opaque typedef through its constructor, so a typedef that
+// validates its value applies the same rules to parsed text.  An exception
+// thrown by that constructor propagates.  A string typedef takes the whole
+// range.
+//
+
+/// Opaque typedefs whose value can be read by opaque::from_chars
+template <typename O>
+concept chars_parsable = chars_formattable<O>
+  and std::is_constructible_v<O, typename O::underlying_type>;
+
+///
+/// Read the value of an opaque typedef, in the manner of std::from_chars
+///
+/// out is assigned only if a value was read.
+///
+template <chars_parsable O, typename... Args>
+std::from_chars_result from_chars(const char * first, const char * last,
+    O& out, Args... args) {
+  typename O::underlying_type u{};
+  const auto r = detail::from_chars_value(first, last, u, args...);
+  if (r.ec == std::errc()) out = O(std::move(u));
+  return r;
+}
+
+///
+/// Parse one column of delimited text, appending the values to a vector
+///
+/// Records end with a newline (optionally preceded by a carriage return)
+/// and fields are separated by the delimiter; empty lines are skipped.
+/// Quoting is not supported, so this suits machine-generated CSV and TSV.
+/// Separators are located sixteen bytes at a time with SIMD.
+///
+/// Each field must parse completely, without surrounding whitespace.
+/// Throws std::invalid_argument naming the line of a field that does not,
+/// or of a record with too few fields, leaving the vector unchanged.
+/// Returns the number of values added.
+///
+template <chars_parsable O>
+std::size_t parse_column(std::string_view text, std::vector<O>& out,
+    std::size_t column = 0, char delimiter = ',') {
+  const std::size_t old = out.size();
+  const char * start = text.data();
+  const char * const end = text.data() + text.size();
+  std::size_t field = 0;
+  std::size_t line = 1;
+
+  const auto fail = [&](const char * what) {
+    throw std::invalid_argument(std::string("opaque::parse_column: ") + what +
+        " on line " + std::to_string(line));
+  };
+  const auto take = [&](const char * first, const char * last) {
+    O value{};
+    const auto r = opaque::from_chars(first, last, value);
+    if (r.ec != std::errc() or r.ptr != last) fail("bad value");
+    out.push_back(std::move(value));
+  };
+  const auto end_record = [&](const char * p) {
+    const char * last = p != start and p[-1] == '\r' ? p - 1 : p;
+    if (field == 0 and last == start) {
+      // empty line
+    } else if (field == column) {
+      take(start, last);
+    } else if (field < column) {
+      fail("missing column");
+    }
+    field = 0;
+    start = p == end ? end : p + 1;
+    ++line;
+  };
+
+  try {
+    detail::for_each_either(text.data(), end, '\n', delimiter,
+        [&](const char * p) {
+          if (*p == '\n') {
+            end_record(p);
+          } else {
+            if (field == column) take(start, p);
+            ++field;
+            start = p + 1;
+          }
+          return true;
+        });
+    if (start != end or field != 0) end_record(end);
+  } catch (...) {
+    out.erase(out.begin() + static_cast<std::ptrdiff_t>(old), out.end());
+    throw;
+  }
+  return out.size() - old;
+}
+
+/// @}
+
+}
+
+#endif
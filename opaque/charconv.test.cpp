@@ -0,0 +1,213 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/charconv.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/inconvertibool.hpp"
+#include "opaque/string_typedef.hpp"
+#include "opaque/string_view_typedef.hpp"
+#include "opaque/ostream.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+struct price : opaque::numeric_typedef<std::int64_t, price> {
+  using base = opaque::numeric_typedef<std::int64_t, price>;
+  using base::base;
+};
+
+struct ratio : opaque::numeric_typedef<double, ratio> {
+  using base = opaque::numeric_typedef<double, ratio>;
+  using base::base;
+};
+
+struct symbol : opaque::experimental::string_typedef<std::string, symbol> {
+  using base = opaque::experimental::string_typedef<std::string, symbol>;
+  using base::base;
+};
+
+struct level : opaque::numeric_typedef<std::int8_t, level> {
+  using base = opaque::numeric_typedef<std::int8_t, level>;
+  using base::base;
+};
+
+using symbol_view = opaque::experimental::string_view_typedef<symbol>;
+
+static_assert(opaque::chars_formattable<price>);
+static_assert(opaque::chars_formattable<symbol>);
+static_assert(not opaque::chars_formattable<std::int64_t>);
+
+template <typename T>
+std::string streamed(const T& t) {
+  std::ostringstream os;
+  os << t;
+  return os.str();
+}
+
+TEST(matches_ostream) {
+  char buf[64];
+  const auto same = [&](const auto& v) {
+    return opaque::format_to_buffer(buf, v) == streamed(v);
+  };
+  CHECK(same(price(-1234567)));
+  CHECK(same(ratio(0.25)));
+  CHECK(same(symbol("AAPL")));
+  CHECK(same(symbol_view(symbol("MSFT"))));
+  CHECK(same(opaque::inconvertibool(true)));
+}
+
+TEST(arguments) {
+  char buf[64];
+  CHECK_EQUAL(std::string_view("ff"), opaque::format_to_buffer(buf, price(255), 16));
+  CHECK_EQUAL(std::string_view("1.50"), opaque::format_to_buffer(buf, ratio(1.5),
+        std::chars_format::fixed, 2));
+}
+
+TEST(small_integers_are_numbers) {
+  // Unlike operator<<, which writes std::int8_t as a character
+  char buf[8];
+  CHECK_EQUAL(std::string_view("65"), opaque::format_to_buffer(buf, level(std::int8_t{65})));
+  CHECK_EQUAL(std::string_view("-7"), opaque::format_to_buffer(buf, level(std::int8_t{-7})));
+  level l;
+  const std::string_view text("-128");
+  const auto r = opaque::from_chars(text.data(), text.data() + text.size(), l);
+  CHECK(r.ec == std::errc());
+  CHECK(l == level(std::int8_t{-128}));
+}
+
+TEST(overflow) {
+  char buf[3];
+  const auto r = opaque::to_chars(buf, buf + 3, price(12345));
+  CHECK(r.ec == std::errc::value_too_large);
+  CHECK(opaque::to_chars(buf, buf + 3, symbol("ABCD")).ec ==
+      std::errc::value_too_large);
+  try {
+    opaque::format_to_buffer(buf, price(12345));
+    CHECK_CATCH(std::length_error, e);
+  }
+}
+
+TEST(span) {
+  std::vector<price> prices;
+  for (int i = 0; i < 100; ++i) prices.push_back(price(i));
+  char buf[64];
+  std::string all;
+  std::span<const price> rest(prices);
+  while (not rest.empty()) {
+    const auto r = opaque::format_span(rest, buf, ',');
+    CHECK(r.values > 0);
+    if (r.values == 0) break;
+    CHECK_EQUAL(',', buf[r.size - 1]);
+    all.append(buf, r.size);
+    rest = rest.subspan(r.values);
+  }
+  std::string expected;
+  for (int i = 0; i < 100; ++i) expected += std::to_string(i) + ',';
+  CHECK_EQUAL(expected, all);
+  // A value that cannot fit is not written at all
+  const auto r = opaque::format_span(std::span(prices).subspan(10), std::span(buf, 2));
+  CHECK_EQUAL(0u, r.values);
+  CHECK_EQUAL(0u, r.size);
+}
+
+struct positive : opaque::numeric_typedef<int, positive> {
+  using base = opaque::numeric_typedef<int, positive>;
+  positive() : base(1) { }
+  explicit positive(int v) : base(v) {
+    if (v <= 0) throw std::domain_error("positive");
+  }
+};
+
+TEST(from_chars) {
+  const std::string_view text = "-42 rest";
+  price p(0);
+  auto r = opaque::from_chars(text.data(), text.data() + text.size(), p);
+  CHECK(r.ec == std::errc());
+  CHECK_EQUAL(3, r.ptr - text.data());
+  CHECK(p == price(-42));
+  const std::string_view hex = "ff";
+  r = opaque::from_chars(hex.data(), hex.data() + 2, p, 16);
+  CHECK(p == price(255));
+  const std::string_view bad = "x1";
+  r = opaque::from_chars(bad.data(), bad.data() + 2, p);
+  CHECK(r.ec == std::errc::invalid_argument);
+  CHECK(p == price(255));
+  symbol s;
+  const std::string_view name = "AAPL";
+  opaque::from_chars(name.data(), name.data() + 4, s);
+  CHECK(s == symbol("AAPL"));
+  positive q;
+  const std::string_view zero = "0";
+  try {
+    opaque::from_chars(zero.data(), zero.data() + 1, q);
+    CHECK_CATCH(std::domain_error, e);
+  }
+}
+
+TEST(parse_column) {
+  std::vector<price> prices;
+  const std::string csv =
+    "id,px,sym\r\n"
+    "1,100,AAPL\r\n"
+    "\r\n"
+    "2,-7,MSFT\n"
+    "3,12345678901,LONGER_SYMBOL_NAME_TO_CROSS_A_VECTOR";
+  CHECK_EQUAL(3u, opaque::parse_column(std::string_view(csv).substr(11),
+        prices, 1));
+  CHECK(prices == std::vector<price>({ price(100), price(-7),
+          price(12345678901) }));
+  std::vector<symbol> syms;
+  opaque::parse_column(std::string_view(csv), syms, 2);
+  CHECK_EQUAL(4u, syms.size());
+  CHECK(syms[3] == symbol("LONGER_SYMBOL_NAME_TO_CROSS_A_VECTOR"));
+  std::vector<ratio> tsv;
+  opaque::parse_column("0.5\t1\n1.25\t2\n", tsv, 0, '\t');
+  CHECK_EQUAL(2u, tsv.size());
+  try {
+    opaque::parse_column(csv, prices, 1);
+    CHECK_CATCH(std::invalid_argument, e);
+    CHECK(std::string(e.what()).find("line 1") != std::string::npos);
+  }
+  try {
+    opaque::parse_column("1,2\n3\n", prices, 1);
+    CHECK_CATCH(std::invalid_argument, e);
+    CHECK(std::string(e.what()).find("line 2") != std::string::npos);
+  }
+  CHECK_EQUAL(3u, prices.size());
+  // Long single column, crossing many vector blocks
+  std::string many;
+  for (int i = 0; i < 1000; ++i) many += std::to_string(i) + '\n';
+  prices.clear();
+  opaque::parse_column(many, prices);
+  CHECK_EQUAL(1000u, prices.size());
+  CHECK(prices[999] == price(999));
+}
@@ -0,0 +1,94 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/compressed_positions.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+struct nanos : opaque::numeric_typedef<std::int64_t, nanos> {
+  using base = opaque::numeric_typedef<std::int64_t, nanos>;
+  using base::base;
+};
+
+struct stamp : opaque::position_typedef<nanos, stamp> {
+  using base = opaque::position_typedef<nanos, stamp>;
+  using base::base;
+};
+
+using seq = opaque::compressed_positions<stamp>;
+
+static void run(const char * name, const std::vector<stamp>& v) {
+  const std::size_t n = v.size();
+  char label[128];
+  seq s;
+  std::snprintf(label, sizeof(label), "%s compress", name);
+  measure(label, n, [&] { s = seq(std::span<const stamp>(v)); });
+  std::printf("%-52s %12.2f x\n", name, s.compression_ratio());
+
+  std::vector<stamp> out(n, stamp(0));
+  std::snprintf(label, sizeof(label), "%s decode", name);
+  const double ns = measure(label, n, [&] {
+    s.decode(out);
+    keep(out.data());
+  });
+  std::printf("%-52s %12.2f GB/s\n", name,
+      static_cast<double>(sizeof(stamp)) / ns);
+  std::snprintf(label, sizeof(label), "%s iterate", name);
+  measure(label, n, [&] {
+    std::int64_t sum = 0;
+    for (const stamp p : s) sum += p.value;
+    keep(sum);
+  });
+  std::snprintf(label, sizeof(label), "%s lower_bound", name);
+  std::mt19937_64 rng(2);
+  const std::size_t lookups = 100000;
+  measure(label, lookups, [&] {
+    std::size_t sum = 0;
+    for (std::size_t i = 0; i < lookups; ++i) {
+      sum += s.lower_bound(v[rng() % n]);
+    }
+    keep(sum);
+  });
+}
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 10000000);
+  std::mt19937_64 rng(1);
+  std::vector<stamp> ticks, offsets;
+  std::int64_t t = 1700000000000000000, o = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    t += static_cast<std::int64_t>(rng() % 2000000);  // ~1 ms apart
+    o += static_cast<std::int64_t>(rng() % 4096);
+    ticks.emplace_back(t);
+    offsets.emplace_back(o);
+  }
+  run("timestamps", ticks);
+  run("file offsets", offsets);
+}
@@ -0,0 +1,339 @@
+#ifndef OPAQUE_COMPRESSED_POSITIONS_HPP
+#define OPAQUE_COMPRESSED_POSITIONS_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/position_typedef.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+//
+// Fixed-width bit packing of blocks of 128 unsigned values
+//
+// A block packed at width B occupies exactly 2*B 64-bit words, value i at
+// bit offset i*B.  Unpacking is generated for each width as straight-line
+// code in which every word index, shift and mask is a constant.
+//
+
+inline constexpr std::size_t packed_block = 128;
+
+inline void pack_block(const std::uint64_t * in, unsigned width,
+    std::uint64_t * out) noexcept {
+  std::fill(out, out + 2 * width, std::uint64_t{0});
+  if (width == 0) return;
+  for (std::size_t i = 0; i < packed_block; ++i) {
+    const std::size_t pos = i * width;
+    const std::size_t w = pos / 64;
+    const unsigned s = static_cast<unsigned>(pos % 64);
+    out[w] |= in[i] << s;
+    if (s + width > 64) out[w + 1] |= in[i] >> (64 - s);
+  }
+}
+
+template <unsigned B, std::size_t I>
+inline std::uint64_t unpack_one(const std::uint64_t * in) noexcept {
+  constexpr std::uint64_t mask = B == 64 ? ~std::uint64_t{0}
+                                         : (std::uint64_t{1} << B) - 1;
+  constexpr std::size_t w = I * B / 64;
+  constexpr unsigned s = static_cast<unsigned>(I * B % 64);
+  std::uint64_t v = in[w] >> s;
+  if constexpr (s + B > 64) v |= in[w + 1] << (64 - s);
+  return v & mask;
+}
+
+template <unsigned B, std::size_t... I>
+void unpack_block(const std::uint64_t * in, std::uint64_t * out,
+    std::index_sequence<I...>) noexcept {
+  ((out[I] = unpack_one<B, I>(in)), ...);
+}
+
+template <unsigned B>
+void unpack_block(const std::uint64_t * in, std::uint64_t * out) noexcept {
+  if constexpr (B == 0) {
+    std::fill(out, out + packed_block, std::uint64_t{0});
+  } else {
+    unpack_block<B>(in, out, std::make_index_sequence<packed_block>());
+  }
+}
+
+using unpack_fn = void (*)(const std::uint64_t *, std::uint64_t *) noexcept;
+
+template <std::size_t... B>
+constexpr std::array<unpack_fn, sizeof...(B)>
+make_unpackers(std::index_sequence<B...>) noexcept {
+  return { &unpack_block<static_cast<unsigned>(B)>... };
+}
+
+inline constexpr auto unpackers =
+  make_unpackers(std::make_index_sequence<65>());
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Compressed non-decreasing sequence of positions
+///
+/// Positions are stored as distances from their predecessor, in blocks of
+/// 128 bit-packed at the width of the largest distance in the block.  A
+/// table of block headers (first position, width and word offset) serves
+/// as skip pointers, so finding the block of any index is O(1) and
+/// lower_bound searches the headers before decoding one block.  Positions
+/// appended after the last full block are kept uncompressed until the
+/// block fills.
+///
+/// Template arguments:
+///  -# Position : A position_typedef (or numeric typedef) over an integer
+///
+template <typename Position>
+class compressed_positions {
+  using raw_type = typename Position::underlying_type;
+  using delta_type = std::make_unsigned_t<raw_type>;
+  static_assert(std::is_integral_v<raw_type> and sizeof(raw_type) <= 8,
+      "compressed_positions requires an integer underlying type");
+
+  static constexpr std::size_t block = detail::packed_block;
+
+  struct header {
+    raw_type      base;
+    std::uint32_t offset;
+    std::uint8_t  width;
+  };
+
+public:
+  using value_type = Position;
+  using size_type  = std::size_t;
+
+  ///
+  /// Forward iterator decoding one block at a time
+  ///
+  class const_iterator {
+    friend class compressed_positions;
+    const_iterator(const compressed_positions * c, size_type i)
+      : owner(c), index(i) { load(); }
+
+    void load() {
+      if (index < owner->packed_size()) {
+        owner->decode_block(index / block, buffer.data());
+      }
+    }
+
+    const compressed_positions * owner = nullptr;
+    size_type index = 0;
+    std::array<raw_type, block> buffer;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = Position;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = Position;
+
+    const_iterator() = default;
+
+    Position operator*() const {
+      if (index < owner->packed_size()) return Position(buffer[index % block]);
+      return Position(owner->tail_[index - owner->packed_size()]);
+    }
+
+    const_iterator& operator++() {
+      if (++index % block == 0) load();
+      return *this;
+    }
+    const_iterator operator++(int) {
+      const_iterator r(*this); ++*this; return r;
+    }
+
+    friend bool operator==(const const_iterator& a, const const_iterator& b)
+      noexcept { return a.index == b.index; }
+  };
+
+  compressed_positions() = default;
+
+  /// Compress a non-decreasing sequence; throws std::invalid_argument if not
+  explicit compressed_positions(std::span<const Position> positions) {
+    headers_.reserve(positions.size() / block);
+    for (const auto& p : positions) push_back(p);
+  }
+
+  size_type size()  const noexcept { return packed_size() + tail_.size(); }
+  bool      empty() const noexcept { return size() == 0; }
+  size_type block_count() const noexcept { return headers_.size(); }
+
+  /// Bytes of storage used, excluding unused capacity
+  size_type memory_bytes() const noexcept {
+    return headers_.size() * sizeof(header) +
+           words_.size() * sizeof(std::uint64_t) +
+           tail_.size() * sizeof(raw_type);
+  }
+
+  /// Uncompressed size divided by compressed size
+  double compression_ratio() const noexcept {
+    const size_type m = memory_bytes();
+    return m ? static_cast<double>(size() * sizeof(Position)) /
+               static_cast<double>(m) : 1.0;
+  }
+
+  /// Append a position, which must not precede the last one
+  void push_back(const Position& p) {
+    const raw_type v = p.value;
+    if (not empty() and v < last_) {
+      throw std::invalid_argument(
+          "opaque::compressed_positions requires non-decreasing positions");
+    }
+    last_ = v;
+    tail_.push_back(v);
+    if (tail_.size() == block) seal();
+  }
+
+  /// The position at index i, with no bounds check
+  Position operator[](size_type i) const {
+    if (i >= packed_size()) return Position(tail_[i - packed_size()]);
+    std::array<raw_type, block> buf;
+    decode_block(i / block, buf.data());
+    return Position(buf[i % block]);
+  }
+
+  Position at(size_type i) const {
+    if (i >= size()) throw std::out_of_range("opaque::compressed_positions::at");
+    return (*this)[i];
+  }
+
+  const_iterator begin() const { return const_iterator(this, 0); }
+  const_iterator end()   const { return const_iterator(this, size()); }
+
+  /// Index of the first position not less than p
+  size_type lower_bound(const Position& p) const {
+    const raw_type v = p.value;
+    // The last block whose first position is below v holds the answer, if
+    // any block does
+    const auto h = std::partition_point(headers_.begin(), headers_.end(),
+        [&](const header& x) { return x.base < v; });
+    if (h != headers_.begin()) {
+      const auto b = static_cast<size_type>(h - headers_.begin()) - 1;
+      std::array<raw_type, block> buf;
+      decode_block(b, buf.data());
+      const auto it = std::lower_bound(buf.begin(), buf.end(), v);
+      if (it != buf.end()) {
+        return b * block + static_cast<size_type>(it - buf.begin());
+      }
+    }
+    if (h != headers_.end()) {
+      return static_cast<size_type>(h - headers_.begin()) * block;
+    }
+    const auto t = std::lower_bound(tail_.begin(), tail_.end(), v);
+    return packed_size() + static_cast<size_type>(t - tail_.begin());
+  }
+
+  ///
+  /// Decode every position into out, which must be at least size() long
+  ///
+  /// This is the fastest way to read the whole sequence.
+  ///
+  void decode(std::span<Position> out) const {
+    if (out.size() < size()) {
+      throw std::length_error("opaque::compressed_positions::decode");
+    }
+    std::array<raw_type, block> buf;
+    for (size_type b = 0; b < headers_.size(); ++b) {
+      decode_block(b, buf.data());
+      for (size_type i = 0; i < block; ++i) {
+        out[b * block + i].value = buf[i];
+      }
+    }
+    for (size_type i = 0; i < tail_.size(); ++i) {
+      out[packed_size() + i].value = tail_[i];
+    }
+  }
+
+private:
+  size_type packed_size() const noexcept { return headers_.size() * block; }
+
+  void seal() {
+    std::uint64_t deltas[block];
+    delta_type highest = 0;
+    for (size_type i = 0; i < block; ++i) {
+      const auto d = static_cast<delta_type>(
+          static_cast<delta_type>(tail_[i]) -
+          static_cast<delta_type>(i ? tail_[i - 1] : tail_[0]));
+      deltas[i] = d;
+      highest |= d;
+    }
+    const auto width = static_cast<unsigned>(std::bit_width(highest));
+    const size_type offset = words_.size();
+    if (offset > UINT32_MAX) {
+      throw std::length_error("opaque::compressed_positions is full");
+    }
+    words_.resize(offset + 2 * width);
+    detail::pack_block(deltas, width, words_.data() + offset);
+    headers_.push_back({ tail_[0], static_cast<std::uint32_t>(offset),
+                         static_cast<std::uint8_t>(width) });
+    tail_.clear();
+  }
+
+  void decode_block(size_type b, raw_type * out) const {
+    const header& h = headers_[b];
+    std::uint64_t deltas[block];
+    detail::unpackers[h.width](words_.data() + h.offset, deltas);
+    auto acc = static_cast<delta_type>(h.base);
+    for (size_type i = 0; i < block; ++i) {
+      acc = static_cast<delta_type>(acc + deltas[i]);
+      out[i] = static_cast<raw_type>(acc);
+    }
+  }
+
+  std::vector<header>        headers_;
+  std::vector<std::uint64_t> words_;
+  std::vector<raw_type>      tail_;
+  raw_type                   last_ = raw_type();
+};
+
+/// @}
+
+}
+
+#endif
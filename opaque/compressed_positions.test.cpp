@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/compressed_positions.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+struct nanos : opaque::numeric_typedef<std::int64_t, nanos> {
+  using base = opaque::numeric_typedef<std::int64_t, nanos>;
+  using base::base;
+};
+
+struct stamp : opaque::position_typedef<nanos, stamp> {
+  using base = opaque::position_typedef<nanos, stamp>;
+  using base::base;
+};
+
+using seq = opaque::compressed_positions<stamp>;
+
+static std::vector<stamp> make(std::size_t n, std::uint64_t spread,
+    std::int64_t first = 1700000000000000000) {
+  std::mt19937_64 rng(n);
+  std::vector<stamp> v;
+  std::int64_t t = first;
+  for (std::size_t i = 0; i < n; ++i) {
+    t += static_cast<std::int64_t>(spread ? rng() % spread : 0);
+    v.emplace_back(t);
+  }
+  return v;
+}
+
+TEST(round_trip) {
+  for (std::size_t n : { 0u, 1u, 127u, 128u, 129u, 1000u, 10000u }) {
+    for (std::uint64_t spread : { 0u, 1u, 1000u, 1u << 30 }) {
+      const auto v = make(n, spread);
+      const seq s{std::span<const stamp>(v)};
+      CHECK_EQUAL(n, s.size());
+      std::size_t i = 0;
+      bool same = true;
+      for (const stamp p : s) same = same and p == v[i++];
+      CHECK(same);
+      CHECK_EQUAL(n, i);
+      std::vector<stamp> out(n, stamp(0));
+      s.decode(out);
+      CHECK(out == v);
+      for (std::size_t j = 0; j < n; j += 37) {
+        CHECK(s[j] == v[j]);
+      }
+    }
+  }
+}
+
+TEST(extremes) {
+  // Deltas spanning the whole range need the full 64-bit width
+  std::vector<stamp> v;
+  for (int i = 0; i < 200; ++i) {
+    v.emplace_back(i % 2 ? std::numeric_limits<std::int64_t>::max() - 200 + i
+                         : std::numeric_limits<std::int64_t>::min() + i);
+  }
+  std::sort(v.begin(), v.end());
+  const seq s{std::span<const stamp>(v)};
+  std::vector<stamp> out(v.size(), stamp(0));
+  s.decode(out);
+  CHECK(out == v);
+}
+
+TEST(compression) {
+  const auto v = make(100000, 1000);
+  const seq s{std::span<const stamp>(v)};
+  CHECK(s.compression_ratio() > 5.0);
+  CHECK_EQUAL(781u, s.block_count());
+}
+
+TEST(lower_bound) {
+  const auto v = make(5000, 10, 0);
+  const seq s{std::span<const stamp>(v)};
+  for (std::int64_t x = -5; x < v.back().value + 5; x += 3) {
+    const auto expected = static_cast<std::size_t>(
+        std::lower_bound(v.begin(), v.end(), stamp(x)) - v.begin());
+    CHECK_EQUAL(expected, s.lower_bound(stamp(x)));
+  }
+}
+
+TEST(errors) {
+  seq s;
+  s.push_back(stamp(5));
+  try {
+    s.push_back(stamp(4));
+    CHECK_CATCH(std::invalid_argument, e);
+  }
+  try {
+    s.at(1);
+    CHECK_CATCH(std::out_of_range, e);
+  }
+}
@@ -0,0 +1,88 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/endian_typedef.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+
+struct seq_num : opaque::numeric_typedef<std::uint32_t, seq_num> {
+  using base = opaque::numeric_typedef<std::uint32_t, seq_num>;
+  using base::base;
+};
+
+struct wire_seq : opaque::big_endian_typedef<seq_num, wire_seq> {
+  using base = opaque::big_endian_typedef<seq_num, wire_seq>;
+  using base::base;
+};
+
+struct be16 : opaque::big_endian_typedef<std::uint16_t, be16> {
+  using base = opaque::big_endian_typedef<std::uint16_t, be16>;
+  using base::base;
+};
+
+struct wire_header {
+  be16     port;
+  be16     length;
+  wire_seq seq;
+};
+
+// The conventional approach: copy into a native struct, then byte swap
+struct native_header {
+  std::uint16_t port;
+  std::uint16_t length;
+  std::uint32_t seq;
+};
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 10000000);
+  std::vector<unsigned char> buffer(n * sizeof(wire_header));
+  std::mt19937 rng(5);
+  for (auto& b : buffer) b = static_cast<unsigned char>(rng());
+
+  measure("memcpy and swap", n, [&] {
+    std::uint64_t sum = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      native_header h;
+      std::memcpy(&h, buffer.data() + i * sizeof(h), sizeof(h));
+      sum += __builtin_bswap16(h.length) + __builtin_bswap32(h.seq);
+    }
+    keep(sum);
+  });
+  measure("overlay endian_typedef", n, [&] {
+    std::uint64_t sum = 0;
+    const auto * h = reinterpret_cast<const wire_header *>(buffer.data());
+    for (std::size_t i = 0; i < n; ++i) {
+      sum += h[i].length.get() + h[i].seq.get().value;
+    }
+    keep(sum);
+  });
+}
@@ -0,0 +1,263 @@
+#ifndef OPAQUE_ENDIAN_TYPEDEF_HPP
+#define OPAQUE_ENDIAN_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/convert.hpp"
+#include "opaque/storage.hpp"
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+template <std::size_t N> struct uint_of_size;
+template <> struct uint_of_size<1> { using type = std::uint8_t;  };
+template <> struct uint_of_size<2> { using type = std::uint16_t; };
+template <> struct uint_of_size<4> { using type = std::uint32_t; };
+template <> struct uint_of_size<8> { using type = std::uint64_t; };
+
+/// Value type stored for T: its underlying type if it is an opaque typedef
+template <typename T, bool = std::is_base_of_v<opaque_tag, T>>
+struct endian_raw { using type = T; };
+template <typename T>
+struct endian_raw<T, true> { using type = typename T::underlying_type; };
+
+/// Reverse the bytes of an unsigned integer
+template <typename U>
+constexpr U byteswap(U x) noexcept {
+#if defined(__GNUC__)
+  if constexpr (sizeof(U) == 2) return __builtin_bswap16(x);
+  if constexpr (sizeof(U) == 4) return __builtin_bswap32(x);
+  if constexpr (sizeof(U) == 8) return __builtin_bswap64(x);
+#endif
+  U r = 0;
+  for (std::size_t i = 0; i < sizeof(U); ++i) {
+    r = static_cast<U>((r << 8) | (x & 0xff));
+    x = static_cast<U>(x >> 8);
+  }
+  return r;
+}
+
+///
+/// The bytes of an arithmetic or enumeration value in a fixed byte order
+///
+/// At run time a value is moved with a single unaligned copy plus a byte
+/// swap when the order is not native; constant evaluation assembles it a
+/// byte at a time.
+///
+template <typename T, std::endian E>
+struct endian_bytes {
+  static_assert(std::is_arithmetic_v<T> or std::is_enum_v<T>,
+      "endian storage requires an arithmetic or enumeration type");
+  static_assert(E == std::endian::big or E == std::endian::little);
+
+  using bits_type = typename uint_of_size<sizeof(T)>::type;
+
+  unsigned char bytes[sizeof(T)];
+
+  static constexpr endian_bytes store(T v) noexcept {
+    const auto bits = std::bit_cast<bits_type>(v);
+    endian_bytes r{};
+    if (std::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < sizeof(T); ++i) {
+        r.bytes[E == std::endian::little ? i : sizeof(T) - 1 - i] =
+          static_cast<unsigned char>(bits >> (8 * i));
+      }
+    } else {
+      const bits_type ordered = E == std::endian::native ? bits : byteswap(bits);
+      std::memcpy(r.bytes, &ordered, sizeof(T));
+    }
+    return r;
+  }
+
+  constexpr T load() const noexcept {
+    bits_type bits = 0;
+    if (std::is_constant_evaluated()) {
+      for (std::size_t i = 0; i < sizeof(T); ++i) {
+        bits = static_cast<bits_type>(bits | bits_type{
+            bytes[E == std::endian::little ? i : sizeof(T) - 1 - i]} << (8 * i));
+      }
+    } else {
+      std::memcpy(&bits, bytes, sizeof(T));
+      if (E != std::endian::native) bits = byteswap(bits);
+    }
+    return std::bit_cast<T>(bits);
+  }
+
+  friend constexpr auto operator<=>(const endian_bytes& a,
+      const endian_bytes& b) noexcept { return a.load() <=> b.load(); }
+  friend constexpr bool operator== (const endian_bytes& a,
+      const endian_bytes& b) noexcept { return a.load() ==  b.load(); }
+};
+
+}
+
+/// @}
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Opaque typedef stored in a fixed byte order
+///
+/// The value is held as bytes in the given order with alignment 1, so the
+/// type is trivially copyable and a struct of such fields can be laid
+/// directly over a wire-format buffer.  There is no padding and no
+/// conversion until a field is read.
+///
+/// The native type T may be an arithmetic or enumeration type, or an opaque
+/// typedef of one (such as a numeric_typedef).  Reading yields T, so
+/// arithmetic is done on the native type and the result stored back:
+///
+///     hdr.seq.set(hdr.seq.get() + seq_num(1));
+///
+/// opaque::converter is specialized to load the native value, so an endian
+/// typedef may stand wherever a converter from it to T is used.
+///
+/// Template arguments for endian_typedef:
+///  -# T : The native type
+///  -# E : The byte order of the storage
+///  -# O : The opaque type, your subclass
+///
+template <typename T, std::endian E, typename O>
+struct endian_typedef
+  : opaque_storage<detail::endian_bytes<typename detail::endian_raw<T>::type,
+                                        E>, O>
+{
+private:
+  using raw_type = typename detail::endian_raw<T>::type;
+  using base = opaque_storage<detail::endian_bytes<raw_type, E>, O>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using native_type = T;
+  using base::value;
+
+  static constexpr std::endian byte_order = E;
+
+  endian_typedef() = default;
+
+  explicit constexpr endian_typedef(const native_type& v) noexcept
+    : base(underlying_type::store(raw(v))) { }
+
+  /// The value in native byte order
+  constexpr native_type get() const noexcept {
+    return native_type(value.load());
+  }
+
+  /// Store a value given in native byte order
+  constexpr opaque_type& set(const native_type& v) & noexcept {
+    value = underlying_type::store(raw(v));
+    return downcast();
+  }
+
+  explicit constexpr operator native_type() const noexcept { return get(); }
+
+  endian_typedef(const endian_typedef& ) = default;
+  endian_typedef(      endian_typedef&&) = default;
+  endian_typedef& operator=(const endian_typedef& ) & = default;
+  endian_typedef& operator=(      endian_typedef&&) & = default;
+protected:
+  ~endian_typedef() = default;
+
+  /// Downcast to the opaque_type
+  constexpr opaque_type& downcast() noexcept {
+    static_assert(std::is_base_of<base, opaque_type>::value, "Bad downcast");
+    return *static_cast<opaque_type*>(this);
+  }
+
+private:
+  static constexpr raw_type raw(const native_type& v) noexcept {
+    if constexpr (std::is_same_v<raw_type, native_type>) {
+      return v;
+    } else {
+      return v.value;
+    }
+  }
+};
+
+template <typename T, typename O>
+using big_endian_typedef = endian_typedef<T, std::endian::big, O>;
+
+template <typename T, typename O>
+using little_endian_typedef = endian_typedef<T, std::endian::little, O>;
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+//
+// Conversion of an endian typedef to its native type, for opaque::converter
+//
+// The native value is always a new object, loaded from the stored bytes.
+//
+
+namespace detail {
+
+template <typename T, typename U>
+concept endian_source = requires { typename U::native_type; }
+  and std::is_same_v<T, typename U::native_type>
+  and std::is_base_of_v<endian_typedef<T, U::byte_order, U>, U>;
+
+template <typename T, typename U, unsigned C>
+struct endian_converter {
+  static constexpr T convert_mutable(const U& u) noexcept { return u.get(); }
+  static constexpr T convert        (const U& u) noexcept { return u.get(); }
+  static constexpr unsigned mutable_cost() noexcept { return C; }
+  static constexpr unsigned         cost() noexcept { return C; }
+};
+
+}
+
+template <typename T, typename U> requires detail::endian_source<T, U>
+struct converter<T, const U&, false> : detail::endian_converter<T, U, 2> { };
+
+template <typename T, typename U> requires detail::endian_source<T, U>
+struct converter<T,       U&, false> : detail::endian_converter<T, U, 2> { };
+
+template <typename T, typename U> requires detail::endian_source<T, U>
+struct converter<T,      U&&, false> : detail::endian_converter<T, U, 1> { };
+
+template <typename T, typename U> requires detail::endian_source<T, U>
+struct converter<T,        U, false> : detail::endian_converter<T, U, 1> { };
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,120 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/endian_typedef.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/convert.hpp"
+#include "arrtest/arrtest.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+
+UNIT_TEST_MAIN
+
+struct seq_num : opaque::numeric_typedef<std::uint32_t, seq_num> {
+  using base = opaque::numeric_typedef<std::uint32_t, seq_num>;
+  using base::base;
+};
+
+struct wire_seq : opaque::big_endian_typedef<seq_num, wire_seq> {
+  using base = opaque::big_endian_typedef<seq_num, wire_seq>;
+  using base::base;
+};
+
+struct be16 : opaque::big_endian_typedef<std::uint16_t, be16> {
+  using base = opaque::big_endian_typedef<std::uint16_t, be16>;
+  using base::base;
+};
+
+struct le64 : opaque::little_endian_typedef<std::int64_t, le64> {
+  using base = opaque::little_endian_typedef<std::int64_t, le64>;
+  using base::base;
+};
+
+struct le_double : opaque::little_endian_typedef<double, le_double> {
+  using base = opaque::little_endian_typedef<double, le_double>;
+  using base::base;
+};
+
+struct header {
+  be16     port;
+  wire_seq seq;
+  le64     stamp;
+};
+
+static_assert(sizeof(header) == 14);
+static_assert(alignof(header) == 1);
+static_assert(std::is_trivially_copyable_v<header>);
+static_assert(std::is_trivially_default_constructible_v<wire_seq>);
+static_assert(not std::is_constructible_v<wire_seq, std::uint32_t>);
+static_assert(not std::is_convertible_v<wire_seq, seq_num>);
+
+static_assert(be16(std::uint16_t{0x1234}).value.bytes[0] == 0x12);
+static_assert(le64(std::int64_t{-2}).get() == -2);
+static_assert(wire_seq(seq_num(7u)).get() == seq_num(7u));
+static_assert(be16(std::uint16_t{1}) < be16(std::uint16_t{256}));
+
+TEST(overlay) {
+  const std::array<unsigned char, sizeof(header)> wire = {
+    0x1f, 0x90,
+    0x00, 0x00, 0x01, 0x02,
+    0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01,
+  };
+  const auto h = std::bit_cast<header>(wire);
+  CHECK_EQUAL(8080, h.port.get());
+  CHECK(h.seq.get() == seq_num(0x102u));
+  CHECK_EQUAL(0x0102030405060708, h.stamp.get());
+}
+
+TEST(arithmetic) {
+  header h{};
+  h.seq.set(seq_num(0xfffffffeu));
+  h.seq.set(h.seq.get() + seq_num(1u));
+  CHECK(h.seq.get() == seq_num(0xffffffffu));
+  CHECK_EQUAL(0xff, h.seq.value.bytes[3]);
+  unsigned char out[sizeof(header)];
+  h.port.set(std::uint16_t{0xabcd});
+  std::memcpy(out, &h, sizeof(h));
+  CHECK_EQUAL(0xab, out[0]);
+  CHECK_EQUAL(0xcd, out[1]);
+}
+
+TEST(floating) {
+  const le_double d(1.5);
+  CHECK(1.5 <= d.get() and d.get() <= 1.5);
+  CHECK_EQUAL(0x3f, d.value.bytes[7]);
+}
+
+TEST(converter) {
+  const be16 p(std::uint16_t{443});
+  using conv = opaque::converter<std::uint16_t, const be16&>;
+  CHECK_EQUAL(443, conv::convert(p));
+  CHECK_EQUAL(443, static_cast<std::uint16_t>(p));
+  const wire_seq s(seq_num(9u));
+  CHECK(opaque::converter<seq_num, const wire_seq&>::convert(s) == seq_num(9u));
+}
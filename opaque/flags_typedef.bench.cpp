@@ -0,0 +1,76 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/flags_typedef.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+enum class order : std::uint32_t {
+  ioc = 1, post_only = 2, hidden = 4, iso = 8, reduce_only = 16 };
+
+struct orders : opaque::flags_typedef<order, orders> {
+  using base = opaque::flags_typedef<order, orders>;
+  using base::base;
+};
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 10000000);
+  std::mt19937 rng(7);
+  std::vector<orders> v;
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    v.push_back(orders::from_bits(rng() & 0x1f));
+  }
+  const orders mask(order::ioc, order::hidden);
+
+  measure("count scalar", n, [&] {
+    std::size_t count = 0;
+    for (const auto& o : v) count += o.test_all(mask);
+    keep(count);
+  });
+  measure("count_with_bits", n, [&] {
+    keep(opaque::count_with_bits(std::span(v), mask));
+  });
+
+  std::vector<std::size_t> out;
+  out.reserve(n);
+  measure("filter scalar", n, [&] {
+    out.clear();
+    for (std::size_t i = 0; i < n; ++i) {
+      if (v[i].test_all(mask)) out.push_back(i);
+    }
+    keep(out.size());
+  });
+  measure("filter_indices", n, [&] {
+    out.clear();
+    opaque::filter_indices(std::span(v), mask, std::back_inserter(out));
+    keep(out.size());
+  });
+}
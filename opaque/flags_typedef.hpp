@@ -0,0 +1,280 @@
+#ifndef OPAQUE_FLAGS_TYPEDEF_HPP
+#define OPAQUE_FLAGS_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/binop_inherit.hpp"
+#include "opaque/inconvertibool_bitvector.hpp"
+#include "opaque/storage.hpp"
+#include "opaque/simd.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opaque {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Opaque typedef for a set of flags from one enumeration
+///
+/// The flags are held as bits of the unsigned counterpart of the underlying
+/// type of the enumeration.  A flags typedef can be created from, and
+/// combined with, only its own enumerators and its own type, so flags of
+/// different enumerations cannot be mixed.  There is deliberately no
+/// constructor from an integer; use from_bits to reinterpret stored bits.
+///
+/// An enumerator may have more than one bit set, in which case test()
+/// requires all of them.
+///
+/// Template arguments for flags_typedef:
+///  -# Enum : The enumeration whose enumerators name the flags
+///  -# O : The opaque type, your subclass
+///
+template <typename Enum, typename O>
+struct flags_typedef
+  : opaque_storage<std::make_unsigned_t<std::underlying_type_t<Enum>>, O>
+  , binop::bitandable<O>
+  , binop::bitxorable<O>
+  , binop::bitorable <O>
+{
+private:
+  using base =
+    opaque_storage<std::make_unsigned_t<std::underlying_type_t<Enum>>, O>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using flag_type = Enum;
+  using base::value;
+
+  /// Bits of an enumerator
+  static constexpr underlying_type bits_of(flag_type f) noexcept {
+    return static_cast<underlying_type>(
+        static_cast<std::underlying_type_t<flag_type>>(f));
+  }
+
+  /// Reinterpret stored bits as a set of flags
+  static constexpr opaque_type from_bits(underlying_type bits) noexcept {
+    opaque_type r;
+    r.value = bits;
+    return r;
+  }
+
+  constexpr flags_typedef() noexcept : base(underlying_type{0}) { }
+
+  /// A single flag converts implicitly to a set holding just that flag
+  constexpr flags_typedef(flag_type f) noexcept : base(bits_of(f)) { }
+
+  template <typename... F>
+  requires (sizeof...(F) > 0 and (std::is_same_v<F, flag_type> and ...))
+  explicit constexpr flags_typedef(flag_type f, F... fs) noexcept
+    : base(static_cast<underlying_type>((bits_of(f) | ... | bits_of(fs))))
+    { }
+
+  constexpr bool test(flag_type f) const noexcept {
+    return (value & bits_of(f)) == bits_of(f);
+  }
+  constexpr bool test_all(const opaque_type& o) const noexcept {
+    return (value & o.value) == o.value;
+  }
+  constexpr bool test_any(const opaque_type& o) const noexcept {
+    return (value & o.value) != 0;
+  }
+
+  constexpr opaque_type& set(flag_type f) & noexcept {
+    value = static_cast<underlying_type>(value | bits_of(f));
+    return downcast(); }
+
+  constexpr opaque_type& clear(flag_type f) & noexcept {
+    value = static_cast<underlying_type>(value & ~bits_of(f));
+    return downcast(); }
+
+  constexpr opaque_type& flip(flag_type f) & noexcept {
+    value = static_cast<underlying_type>(value ^ bits_of(f));
+    return downcast(); }
+
+  constexpr opaque_type& reset() & noexcept {
+    value = 0;
+    return downcast(); }
+
+  constexpr bool none() const noexcept { return value == 0; }
+  constexpr bool  any() const noexcept { return value != 0; }
+  constexpr int count() const noexcept { return std::popcount(value); }
+
+  /// Check whether any flag is set
+  explicit constexpr operator bool() const noexcept { return any(); }
+
+  constexpr opaque_type& operator&=(const opaque_type& peer) & noexcept {
+    value = static_cast<underlying_type>(value & peer.value);
+    return downcast(); }
+
+  constexpr opaque_type& operator^=(const opaque_type& peer) & noexcept {
+    value = static_cast<underlying_type>(value ^ peer.value);
+    return downcast(); }
+
+  constexpr opaque_type& operator|=(const opaque_type& peer) & noexcept {
+    value = static_cast<underlying_type>(value | peer.value);
+    return downcast(); }
+
+  constexpr opaque_type operator~() const noexcept {
+    return from_bits(static_cast<underlying_type>(~value)); }
+
+  flags_typedef(const flags_typedef& ) = default;
+  flags_typedef(      flags_typedef&&) = default;
+  flags_typedef& operator=(const flags_typedef& ) & = default;
+  flags_typedef& operator=(      flags_typedef&&) & = default;
+protected:
+  ~flags_typedef() = default;
+
+  /// Downcast to the opaque_type
+  constexpr opaque_type& downcast() noexcept {
+    static_assert(std::is_base_of<base, opaque_type>::value, "Bad downcast");
+    return *static_cast<opaque_type*>(this);
+  }
+
+};
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+template <typename O>
+concept flags = requires { typename O::flag_type; }
+  and std::is_base_of_v<flags_typedef<typename O::flag_type, O>, O>;
+
+///
+/// Visit the flag words in blocks of up to 64, with a mask of the words
+/// containing all bits of the mask
+///
+/// The visitor receives the index of the first word of the block and the
+/// match mask, and returns false to stop early.
+///
+template <typename O, typename F>
+void for_each_match_block(std::span<const O> words, const O& mask, F&& f) {
+  using U = typename O::underlying_type;
+  const std::size_t n = words.size();
+  std::size_t i = 0;
+  if constexpr (sizeof(O) == sizeof(U)) {
+    for (; i + 64 <= n; i += 64) {
+      if (not f(i, masked_equal_64<U>(words.data() + i, mask.value, mask.value))) {
+        return;
+      }
+    }
+  }
+  while (i < n) {
+    const std::size_t block = n - i < 64 ? n - i : 64;
+    std::uint64_t m = 0;
+    for (std::size_t j = 0; j < block; ++j) {
+      m |= std::uint64_t{words[i + j].test_all(mask)} << j;
+    }
+    if (not f(i, m)) return;
+    i += block;
+  }
+}
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+//
+// Bulk predicates over spans of flags
+//
+// A word matches when it contains all bits of the mask.  Blocks of 64 words
+// are compared with SIMD into a bit per word, so a scan processes several
+// words per instruction and counting reduces to population counts.
+//
+
+/// Check whether any word contains all bits of the mask
+template <typename O> requires detail::flags<O>
+bool any_of_bits(std::span<const std::type_identity_t<O>> words,
+    const O& mask) {
+  bool found = false;
+  detail::for_each_match_block<O>(words, mask,
+      [&](std::size_t, std::uint64_t m) { found = m != 0; return not found; });
+  return found;
+}
+
+/// Count the words containing all bits of the mask
+template <typename O> requires detail::flags<O>
+std::size_t count_with_bits(std::span<const std::type_identity_t<O>> words,
+    const O& mask) {
+  std::size_t count = 0;
+  detail::for_each_match_block<O>(words, mask,
+      [&](std::size_t, std::uint64_t m) {
+        count += static_cast<std::size_t>(std::popcount(m));
+        return true;
+      });
+  return count;
+}
+
+///
+/// Write the indices of the words containing all bits of the mask, in
+/// increasing order, to an output iterator
+///
+template <typename O, typename OutputIt> requires detail::flags<O>
+OutputIt filter_indices(std::span<const std::type_identity_t<O>> words,
+    const O& mask, OutputIt out) {
+  detail::for_each_match_block<O>(words, mask,
+      [&](std::size_t first, std::uint64_t m) {
+        for (; m; m &= m - 1) {
+          *out++ = first + static_cast<std::size_t>(std::countr_zero(m));
+        }
+        return true;
+      });
+  return out;
+}
+
+///
+/// Build a selection mask of the words containing all bits of the mask
+///
+template <typename O> requires detail::flags<O>
+inconvertibool_bitvector select_with_bits(
+    std::span<const std::type_identity_t<O>> words, const O& mask) {
+  std::vector<std::uint64_t> bits;
+  bits.reserve((words.size() + 63) / 64);
+  detail::for_each_match_block<O>(words, mask,
+      [&](std::size_t, std::uint64_t m) { bits.push_back(m); return true; });
+  return inconvertibool_bitvector::from_words(std::move(bits), words.size());
+}
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/flags_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+enum class perm : std::uint8_t {
+  read = 1, write = 2, exec = 4, sticky = 8, rw = read | write };
+
+enum class other : std::uint8_t { a = 1 };
+
+struct perms : opaque::flags_typedef<perm, perms> {
+  using base = opaque::flags_typedef<perm, perms>;
+  using base::base;
+};
+
+enum class order : std::uint32_t {
+  ioc = 1, post_only = 2, hidden = 4, iso = 1u << 31 };
+
+struct orders : opaque::flags_typedef<order, orders> {
+  using base = opaque::flags_typedef<order, orders>;
+  using base::base;
+};
+
+static_assert(sizeof(perms) == 1);
+static_assert(sizeof(orders) == 4);
+static_assert(std::is_convertible_v<perm, perms>);
+static_assert(not std::is_constructible_v<perms, std::uint8_t>);
+static_assert(not std::is_constructible_v<perms, other>);
+static_assert(not std::is_convertible_v<perms, bool>);
+
+constexpr perms rw = perm::read | perms(perm::write);
+static_assert(rw.test(perm::read) and rw.test(perm::write));
+static_assert(rw.test(perm::rw) and not rw.test(perm::exec));
+static_assert(rw == perms(perm::rw));
+static_assert(perms(perm::read, perm::exec).count() == 2);
+static_assert(perms().none());
+
+TEST(modify) {
+  perms p;
+  CHECK(not p);
+  p.set(perm::exec).set(perm::read);
+  CHECK(p.test(perm::exec));
+  CHECK_EQUAL(2, p.count());
+  p.clear(perm::exec).flip(perm::sticky);
+  CHECK(p == perms(perm::read, perm::sticky));
+  p |= perm::write;
+  CHECK(p.test_all(perms(perm::rw)));
+  p &= ~perms(perm::read);
+  CHECK(not p.test(perm::read));
+  CHECK(p.test_any(perms(perm::read, perm::write)));
+  p ^= p;
+  CHECK(p.none());
+  CHECK(perms::from_bits(5) == perms(perm::read, perm::exec));
+  CHECK_EQUAL(0x80000000u, orders(order::iso).value);
+}
+
+TEST(bulk) {
+  // Sizes that leave partial blocks exercise the scalar tail
+  for (std::size_t n : { 0u, 1u, 63u, 64u, 65u, 200u, 1000u }) {
+    std::vector<orders> v;
+    for (std::size_t i = 0; i < n; ++i) {
+      v.push_back(orders::from_bits(static_cast<std::uint32_t>(i * 2654435761u)));
+    }
+    const orders mask(order::ioc, order::hidden);
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < n; ++i) {
+      if (v[i].test_all(mask)) expected.push_back(i);
+    }
+    std::vector<std::size_t> actual;
+    opaque::filter_indices(std::span(v), mask, std::back_inserter(actual));
+    CHECK(expected == actual);
+    CHECK_EQUAL(expected.size(), opaque::count_with_bits(std::span(v), mask));
+    CHECK_EQUAL(not expected.empty(), opaque::any_of_bits(std::span(v), mask));
+  }
+  std::vector<perms> small(130, perms(perm::read));
+  small[129].set(perm::exec);
+  CHECK_EQUAL(1u, opaque::count_with_bits(std::span(small), perms(perm::exec)));
+  CHECK_EQUAL(130u, opaque::count_with_bits(std::span(small), perms()));
+}
@@ -0,0 +1,91 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/flat_map.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+struct user_id : opaque::numeric_typedef<std::uint64_t, user_id> {
+  using base = opaque::numeric_typedef<std::uint64_t, user_id>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(user_id)
+
+template <typename Map>
+void run(const char * name, const std::vector<user_id>& keys,
+    const std::vector<user_id>& misses) {
+  char label[128];
+  const std::size_t n = keys.size();
+  Map m;
+  std::snprintf(label, sizeof(label), "%s insert", name);
+  measure(label, n, [&] {
+    for (const auto& k : keys) m[k] = k.value;
+  });
+  std::snprintf(label, sizeof(label), "%s lookup hit", name);
+  measure(label, n, [&] {
+    std::uint64_t sum = 0;
+    for (const auto& k : keys) {
+      if (auto it = m.find(k); it != m.end()) sum += it->second;
+    }
+    keep(sum);
+  });
+  std::snprintf(label, sizeof(label), "%s lookup miss", name);
+  measure(label, n, [&] {
+    std::size_t found = 0;
+    for (const auto& k : misses) found += m.count(k);
+    keep(found);
+  });
+  std::snprintf(label, sizeof(label), "%s erase", name);
+  measure(label, n, [&] {
+    for (const auto& k : keys) m.erase(k);
+  });
+  keep(m.size());
+}
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 1000000);
+  std::vector<user_id> sequential, random, misses;
+  std::mt19937_64 rng(42);
+  for (std::size_t i = 0; i < n; ++i) {
+    sequential.emplace_back(i);
+    random.emplace_back(rng() >> 1);
+    misses.emplace_back(rng() | (std::uint64_t{1} << 63));
+  }
+  using flat = opaque::flat_map<user_id, std::uint64_t>;
+  using node = std::unordered_map<user_id, std::uint64_t>;
+  run<flat>("flat_map sequential", sequential, misses);
+  run<node>("unordered_map sequential", sequential, misses);
+  run<flat>("flat_map random", random, misses);
+  run<node>("unordered_map random", random, misses);
+}
@@ -0,0 +1,594 @@
+#ifndef OPAQUE_FLAT_MAP_HPP
+#define OPAQUE_FLAT_MAP_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/storage.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/simd.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Permit a type that is not an opaque typedef to be a flat_map key
+///
+/// Specialize this as std::true_type for an underlying type that you
+/// deliberately want to use as a key.
+///
+template <typename T>
+struct allow_flat_map_key : std::false_type { };
+
+template <typename T>
+inline constexpr bool is_flat_map_key =
+  std::is_base_of_v<opaque_tag, T> or allow_flat_map_key<T>::value;
+
+///
+/// Open-addressing hash map for opaque typedef keys
+///
+/// Keys and values are stored inline in a single slot array, alongside an
+/// array of one control byte per slot.  Lookups probe a whole group of
+/// control bytes at once (SSE2 where available), comparing seven bits of
+/// the hash before touching any slot.
+///
+/// A hash declaring itself avalanching (see opaque::hash_policy) is used as
+/// is; any other hash has its bits mixed first.
+///
+/// Only opaque typedefs, or types for which allow_flat_map_key has been
+/// specialized, may be keys.  Lookup requires the exact key type, or with a
+/// transparent Hash and KeyEqual another opaque type that they accept, so
+/// an argument cannot reach the map through an implicit conversion.
+///
+/// Unlike std::unordered_map, inserting or erasing may invalidate all
+/// iterators and references.
+///
+/// Template arguments:
+///  -# K : The key type, normally an opaque typedef with OPAQUE_HASHABLE
+///  -# V : The mapped type
+///  -# Hash : The hash function for K
+///  -# KeyEqual : The equality predicate for K
+///
+template <typename K, typename V,
+          typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class flat_map {
+  static_assert(is_flat_map_key<K>,
+      "flat_map key must be an opaque typedef or explicitly allowed");
+
+  using group = detail::ctrl_group;
+
+  template <typename Q>
+  static constexpr bool transparent_key = not std::is_same_v<Q, K>
+    and is_flat_map_key<Q>
+    and requires { typename Hash::is_transparent;
+                   typename KeyEqual::is_transparent; }
+    and std::is_invocable_r_v<std::size_t, const Hash&, const Q&>
+    and std::is_invocable_r_v<bool, const KeyEqual&, const K&, const Q&>;
+
+public:
+  using key_type        = K;
+  using mapped_type     = V;
+  using value_type      = std::pair<const K, V>;
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using hasher          = Hash;
+  using key_equal       = KeyEqual;
+  using reference       = value_type&;
+  using const_reference = const value_type&;
+
+  template <bool is_const>
+  class basic_iterator {
+    friend class flat_map;
+    using slot_pointer = std::conditional_t<is_const,
+      const std::pair<const K, V> *, std::pair<const K, V> *>;
+
+    basic_iterator(const std::int8_t * c, slot_pointer s,
+        const std::int8_t * e) noexcept : ctrl(c), slot(s), end(e) {
+      skip_empty();
+    }
+
+    void skip_empty() noexcept {
+      while (ctrl != end and not detail::is_full(*ctrl)) { ++ctrl; ++slot; }
+    }
+
+    const std::int8_t * ctrl = nullptr;
+    slot_pointer        slot = nullptr;
+    const std::int8_t * end  = nullptr;
+
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type        = std::pair<const K, V>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = slot_pointer;
+    using reference         = std::remove_pointer_t<slot_pointer>&;
+
+    basic_iterator() = default;
+    basic_iterator(const basic_iterator&) = default;
+    basic_iterator& operator=(const basic_iterator&) = default;
+    basic_iterator(const basic_iterator<false>& i) noexcept requires is_const
+      : ctrl(i.ctrl), slot(i.slot), end(i.end) { }
+
+    reference operator*()  const noexcept { return *slot; }
+    pointer   operator->() const noexcept { return  slot; }
+
+    basic_iterator& operator++() noexcept {
+      ++ctrl; ++slot; skip_empty();
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept {
+      basic_iterator r(*this); operator++(); return r;
+    }
+
+    friend bool operator==(const basic_iterator& a, const basic_iterator& b)
+      noexcept { return a.ctrl == b.ctrl; }
+  };
+
+  using iterator       = basic_iterator<false>;
+  using const_iterator = basic_iterator<true>;
+
+  flat_map() = default;
+
+  explicit flat_map(size_type n, const Hash& h = Hash(),
+      const KeyEqual& e = KeyEqual())
+    : hash(h), equal(e) { reserve(n); }
+
+  //
+  // These delegate to the sizing constructor so that, once it completes,
+  // a throw while inserting runs the destructor on the partly filled map.
+  //
+  flat_map(std::initializer_list<value_type> il) : flat_map(il.size()) {
+    for (const auto& v : il) insert(v);
+  }
+
+  flat_map(const flat_map& other)
+    : flat_map(other.size(), other.hash, other.equal) {
+    for (const auto& v : other) insert_unique(v);
+  }
+
+  flat_map(flat_map&& other) noexcept
+    : ctrl(std::exchange(other.ctrl, nullptr))
+    , slots(std::exchange(other.slots, nullptr))
+    , capacity_(std::exchange(other.capacity_, 0))
+    , size_(std::exchange(other.size_, 0))
+    , growth_left(std::exchange(other.growth_left, 0))
+    , hash(std::move(other.hash)), equal(std::move(other.equal)) { }
+
+  flat_map& operator=(const flat_map& other) {
+    if (this != &other) { flat_map copy(other); swap(copy); }
+    return *this;
+  }
+
+  flat_map& operator=(flat_map&& other) noexcept {
+    flat_map moved(std::move(other));
+    swap(moved);
+    return *this;
+  }
+
+  ~flat_map() { destroy(); }
+
+  void swap(flat_map& other) noexcept {
+    using std::swap;
+    swap(ctrl       , other.ctrl       );
+    swap(slots      , other.slots      );
+    swap(capacity_  , other.capacity_  );
+    swap(size_      , other.size_      );
+    swap(growth_left, other.growth_left);
+    swap(hash       , other.hash       );
+    swap(equal      , other.equal      );
+  }
+  friend void swap(flat_map& a, flat_map& b) noexcept { a.swap(b); }
+
+  iterator       begin()        noexcept { return iterator_at(0); }
+  const_iterator begin()  const noexcept { return iterator_at(0); }
+  const_iterator cbegin() const noexcept { return iterator_at(0); }
+  iterator       end()          noexcept { return iterator_at(capacity_); }
+  const_iterator end()    const noexcept { return iterator_at(capacity_); }
+  const_iterator cend()   const noexcept { return iterator_at(capacity_); }
+
+  bool      empty()    const noexcept { return size_ == 0; }
+  size_type size()     const noexcept { return size_; }
+  size_type capacity() const noexcept { return capacity_; }
+  float load_factor()  const noexcept {
+    return capacity_ ? static_cast<float>(size_) /
+                       static_cast<float>(capacity_) : 0.0f;
+  }
+  hasher    hash_function() const { return hash; }
+  key_equal key_eq()        const { return equal; }
+
+  void clear() noexcept {
+    destroy_slots();
+    reset_ctrl();
+    size_ = 0;
+    growth_left = capacity_to_growth(capacity_);
+  }
+
+  /// Ensure that n elements fit without rehashing
+  void reserve(size_type n) {
+    if (n > capacity_to_growth(capacity_)) resize(growth_to_capacity(n));
+  }
+
+  /// Rehash to the smallest capacity holding max(n, size()) elements
+  void rehash(size_type n) {
+    resize(growth_to_capacity(n > size_ ? n : size_));
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+    const auto [i, inserted] = find_or_prepare_insert(key);
+    if (inserted) {
+      construct(i, std::piecewise_construct, std::forward_as_tuple(key),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+    return { iterator_at(i), inserted };
+  }
+
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+    const auto [i, inserted] = find_or_prepare_insert(key);
+    if (inserted) {
+      construct(i, std::piecewise_construct,
+          std::forward_as_tuple(std::move(key)),
+          std::forward_as_tuple(std::forward<Args>(args)...));
+    }
+    return { iterator_at(i), inserted };
+  }
+
+  std::pair<iterator, bool> insert(const value_type& v) {
+    return try_emplace(v.first, v.second);
+  }
+
+  std::pair<iterator, bool> insert(value_type&& v) {
+    return try_emplace(v.first, std::move(v.second));
+  }
+
+  template <typename M>
+  std::pair<iterator, bool> insert_or_assign(const key_type& key, M&& m) {
+    auto r = try_emplace(key, std::forward<M>(m));
+    if (not r.second) r.first->second = std::forward<M>(m);
+    return r;
+  }
+
+  mapped_type& operator[](const key_type& key) {
+    return try_emplace(key).first->second;
+  }
+  mapped_type& operator[](key_type&& key) {
+    return try_emplace(std::move(key)).first->second;
+  }
+
+  mapped_type& at(const key_type& key) {
+    const size_type i = find_index(key);
+    if (i == capacity_) throw std::out_of_range("opaque::flat_map::at");
+    return slots[i].second;
+  }
+  const mapped_type& at(const key_type& key) const {
+    const size_type i = find_index(key);
+    if (i == capacity_) throw std::out_of_range("opaque::flat_map::at");
+    return slots[i].second;
+  }
+
+  iterator find(const key_type& key) {
+    return iterator_at(find_index(key));
+  }
+  const_iterator find(const key_type& key) const {
+    return iterator_at(find_index(key));
+  }
+  bool contains(const key_type& key) const {
+    return find_index(key) != capacity_;
+  }
+  size_type count(const key_type& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  //
+  // When both Hash and KeyEqual are transparent, another key type (such as
+  // a string_view_typedef of a string key) may be used for lookup without
+  // converting it.  Lookup with any other type is rejected rather than
+  // converted.
+  //
+  template <typename Q> requires transparent_key<Q>
+  iterator find(const Q& key) {
+    return iterator_at(find_index(key));
+  }
+  template <typename Q> requires transparent_key<Q>
+  const_iterator find(const Q& key) const {
+    return iterator_at(find_index(key));
+  }
+  template <typename Q> requires transparent_key<Q>
+  bool contains(const Q& key) const {
+    return find_index(key) != capacity_;
+  }
+  template <typename Q> requires transparent_key<Q>
+  size_type count(const Q& key) const {
+    return contains(key) ? 1 : 0;
+  }
+
+  template <typename Q> iterator       find(const Q&)           = delete;
+  template <typename Q> const_iterator find(const Q&)     const = delete;
+  template <typename Q> bool           contains(const Q&) const = delete;
+  template <typename Q> size_type      count(const Q&)    const = delete;
+
+  size_type erase(const key_type& key) {
+    const size_type i = find_index(key);
+    if (i == capacity_) return 0;
+    erase_at(i);
+    return 1;
+  }
+
+  iterator erase(const_iterator pos) {
+    const auto i = static_cast<size_type>(pos.slot - slots);
+    erase_at(i);
+    return iterator_at(i + 1);
+  }
+  iterator erase(iterator pos) { return erase(const_iterator(pos)); }
+
+private:
+  //
+  // Table layout
+  //
+  // The capacity is a power of two, and at least one group wide.  The control
+  // array has group::width - 1 extra bytes that mirror the first bytes, so
+  // that a group may be loaded starting at any slot without wrapping.
+  //
+  static constexpr size_type min_capacity = group::width;
+
+  static constexpr size_type capacity_to_growth(size_type cap) noexcept {
+    return cap - cap / 8;
+  }
+
+  static constexpr size_type growth_to_capacity(size_type n) noexcept {
+    size_type cap = min_capacity;
+    while (capacity_to_growth(cap) < n) cap *= 2;
+    return cap;
+  }
+
+  //
+  // std::hash is frequently the identity for integers, which would leave the
+  // seven bits stored in the control bytes and the probe start position
+  // perfectly correlated for sequential keys.  Scramble the bits first,
+  // unless the hash declares that it already does so.
+  //
+  template <typename Q>
+  size_type hash_of(const Q& key) const {
+    if constexpr (detail::avalanching_hash<Hash>) {
+      return static_cast<size_type>(hash(key));
+    } else {
+      return static_cast<size_type>(
+          detail::mix64(static_cast<std::uint64_t>(hash(key))));
+    }
+  }
+
+  static std::int8_t h2(size_type h) noexcept {
+    return static_cast<std::int8_t>(h & 0x7f);
+  }
+
+  size_type mask() const noexcept { return capacity_ - 1; }
+
+  template <typename Q>
+  size_type find_index(const Q& key) const {
+    if (size_ == 0) return capacity_;
+    const size_type h = hash_of(key);
+    size_type pos = (h >> 7) & mask();
+    for (size_type step = group::width; ; step += group::width) {
+      const group g(ctrl + pos);
+      for (auto m = g.match(h2(h)); m; ++m) {
+        const size_type i = (pos + m.lowest()) & mask();
+        if (equal(slots[i].first, key)) return i;
+      }
+      if (g.match_empty()) return capacity_;
+      pos = (pos + step) & mask();
+    }
+  }
+
+  size_type find_first_non_full(size_type h) const noexcept {
+    size_type pos = (h >> 7) & mask();
+    for (size_type step = group::width; ; step += group::width) {
+      const group g(ctrl + pos);
+      if (auto m = g.match_empty_or_deleted()) {
+        return (pos + m.lowest()) & mask();
+      }
+      pos = (pos + step) & mask();
+    }
+  }
+
+  std::pair<size_type, bool> find_or_prepare_insert(const key_type& key) {
+    if (const size_type i = find_index(key); i != capacity_) {
+      return { i, false };
+    }
+    const size_type h = hash_of(key);
+    if (capacity_ == 0) resize(min_capacity);
+    size_type i = find_first_non_full(h);
+    if (growth_left == 0 and ctrl[i] != deleted_ctrl) {
+      grow();
+      i = find_first_non_full(h);
+    }
+    if (ctrl[i] == empty_ctrl) --growth_left;
+    set_ctrl(i, h2(h));
+    return { i, true };
+  }
+
+  template <typename... Args>
+  void construct(size_type i, Args&&... args) {
+    try {
+      std::construct_at(slots + i, std::forward<Args>(args)...);
+    } catch (...) {
+      set_ctrl(i, deleted_ctrl);
+      throw;
+    }
+    ++size_;
+  }
+
+  std::pair<iterator, bool> insert_unique(const value_type& v) {
+    const size_type h = hash_of(v.first);
+    const size_type i = find_first_non_full(h);
+    if (ctrl[i] == empty_ctrl) --growth_left;
+    set_ctrl(i, h2(h));
+    construct(i, v);
+    return { iterator_at(i), true };
+  }
+
+  void erase_at(size_type i) {
+    std::destroy_at(slots + i);
+    set_ctrl(i, deleted_ctrl);
+    --size_;
+  }
+
+  void set_ctrl(size_type i, std::int8_t c) noexcept {
+    ctrl[i] = c;
+    if (i < group::width - 1) ctrl[capacity_ + i] = c;
+  }
+
+  void reset_ctrl() noexcept {
+    if (capacity_ == 0) return;
+    std::fill(ctrl, ctrl + capacity_ + group::width - 1, empty_ctrl);
+  }
+
+  //
+  // Tombstones consume growth, so a table full of them is rehashed in place
+  // rather than doubled.
+  //
+  void grow() {
+    resize(size_ <= capacity_to_growth(capacity_) / 2 ? capacity_
+                                                      : capacity_ * 2);
+  }
+
+  //
+  // Elements are moved only when neither moving them nor hashing their keys
+  // can throw; otherwise they are copied, and the old table is released
+  // only after every copy succeeds.  Either way a throw leaves the map as
+  // it was.  Note that a key of value_type is const, so moving an element
+  // copies its key.
+  //
+  static constexpr bool move_on_resize =
+    std::is_nothrow_move_constructible_v<value_type> and
+    std::is_nothrow_invocable_v<const Hash&, const key_type&>;
+
+  void resize(size_type new_capacity) {
+    std::int8_t * const old_ctrl     = ctrl;
+    value_type  * const old_slots    = slots;
+    const size_type     old_capacity = capacity_;
+    const size_type     old_growth   = growth_left;
+
+    ctrl  = new std::int8_t[new_capacity + group::width - 1];
+    try {
+      slots = std::allocator<value_type>().allocate(new_capacity);
+    } catch (...) {
+      delete[] ctrl;
+      ctrl = old_ctrl;
+      throw;
+    }
+    capacity_ = new_capacity;
+    reset_ctrl();
+    growth_left = capacity_to_growth(capacity_) - size_;
+
+    try {
+      for (size_type i = 0; i < old_capacity; ++i) {
+        if (not detail::is_full(old_ctrl[i])) continue;
+        const size_type h = hash_of(old_slots[i].first);
+        const size_type j = find_first_non_full(h);
+        if constexpr (move_on_resize) {
+          std::construct_at(slots + j, std::move(old_slots[i]));
+          std::destroy_at(old_slots + i);
+        } else {
+          std::construct_at(slots + j, std::as_const(old_slots[i]));
+        }
+        set_ctrl(j, h2(h));
+      }
+    } catch (...) {
+      destroy();
+      ctrl        = old_ctrl;
+      slots       = old_slots;
+      capacity_   = old_capacity;
+      growth_left = old_growth;
+      throw;
+    }
+
+    if constexpr (not move_on_resize) {
+      if constexpr (not std::is_trivially_destructible_v<value_type>) {
+        for (size_type i = 0; i < old_capacity; ++i) {
+          if (detail::is_full(old_ctrl[i])) std::destroy_at(old_slots + i);
+        }
+      }
+    }
+    delete[] old_ctrl;
+    if (old_slots) {
+      std::allocator<value_type>().deallocate(old_slots, old_capacity);
+    }
+  }
+
+  void destroy_slots() noexcept {
+    if constexpr (not std::is_trivially_destructible_v<value_type>) {
+      for (size_type i = 0; i < capacity_; ++i) {
+        if (detail::is_full(ctrl[i])) std::destroy_at(slots + i);
+      }
+    }
+  }
+
+  void destroy() noexcept {
+    if (capacity_ == 0) return;
+    destroy_slots();
+    delete[] ctrl;
+    std::allocator<value_type>().deallocate(slots, capacity_);
+  }
+
+  iterator iterator_at(size_type i) noexcept {
+    return iterator(ctrl + i, slots + i, ctrl + capacity_);
+  }
+  const_iterator iterator_at(size_type i) const noexcept {
+    return const_iterator(ctrl + i, slots + i, ctrl + capacity_);
+  }
+
+  static constexpr std::int8_t empty_ctrl =
+    static_cast<std::int8_t>(detail::ctrl::empty);
+  static constexpr std::int8_t deleted_ctrl =
+    static_cast<std::int8_t>(detail::ctrl::deleted);
+
+  std::int8_t * ctrl        = nullptr;
+  value_type  * slots       = nullptr;
+  size_type     capacity_   = 0;
+  size_type     size_       = 0;
+  size_type     growth_left = 0;
+  [[no_unique_address]] Hash     hash;
+  [[no_unique_address]] KeyEqual equal;
+};
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,227 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/flat_map.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "arrtest/arrtest.hpp"
+#include <stdexcept>
+#include <string>
+
+UNIT_TEST_MAIN
+
+struct safe_int : opaque::numeric_typedef<int, safe_int> {
+  using base = opaque::numeric_typedef<int, safe_int>;
+  using base::base;
+};
+
+struct a_string : opaque::experimental::string_typedef<std::string, a_string> {
+  using base = opaque::experimental::string_typedef<std::string, a_string>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(safe_int)
+OPAQUE_HASHABLE(a_string)
+
+template <>
+struct opaque::allow_flat_map_key<long> : std::true_type { };
+
+// Key whose copies throw once armed, to probe resize under exceptions
+struct fragile_key {
+  static inline int copies_left = -1;
+  int value;
+  explicit fragile_key(int v) : value(v) { }
+  fragile_key(const fragile_key& o) : value(o.value) {
+    if (copies_left == 0) throw std::runtime_error("copy");
+    if (copies_left > 0) --copies_left;
+  }
+  friend bool operator==(const fragile_key&, const fragile_key&) = default;
+};
+
+struct fragile_hash {
+  std::size_t operator()(const fragile_key& k) const noexcept {
+    return std::hash<int>{}(k.value);
+  }
+};
+
+template <>
+struct opaque::allow_flat_map_key<fragile_key> : std::true_type { };
+
+// Mapped value that counts live instances and whose copies throw once armed
+struct fragile_value {
+  static inline int live = 0;
+  static inline int copies_left = -1;
+  int value;
+  explicit fragile_value(int v) : value(v) { ++live; }
+  fragile_value(const fragile_value& o) : value(o.value) {
+    if (copies_left == 0) throw std::runtime_error("copy");
+    if (copies_left > 0) --copies_left;
+    ++live;
+  }
+  ~fragile_value() { --live; }
+};
+
+template <typename M, typename Q>
+concept can_find = requires(const M& m, const Q& q) { m.find(q); };
+
+static_assert(    can_find<opaque::flat_map<safe_int, int>, safe_int>);
+static_assert(not can_find<opaque::flat_map<safe_int, int>, int>);
+static_assert(    can_find<opaque::flat_map<long, int>, long>);
+
+TEST(insert_find) {
+  opaque::flat_map<safe_int, int> m;
+  CHECK_EQUAL(true, m.empty());
+  CHECK_EQUAL(true, m.find(safe_int(1)) == m.end());
+  for (int i = 0; i < 1000; ++i) {
+    CHECK_EQUAL(true, m.try_emplace(safe_int(i), i * 2).second);
+  }
+  CHECK_EQUAL(false, m.try_emplace(safe_int(7), 0).second);
+  CHECK_EQUAL(1000u, m.size());
+  for (int i = 0; i < 1000; ++i) {
+    auto it = m.find(safe_int(i));
+    CHECK_EQUAL(true, it != m.end());
+    CHECK_EQUAL(i * 2, it->second);
+  }
+  CHECK_EQUAL(false, m.contains(safe_int(1000)));
+  CHECK_EQUAL(0u, m.count(safe_int(-1)));
+}
+
+TEST(erase) {
+  opaque::flat_map<safe_int, int> m;
+  for (int i = 0; i < 100; ++i) m[safe_int(i)] = i;
+  for (int i = 0; i < 100; i += 2) {
+    CHECK_EQUAL(1u, m.erase(safe_int(i)));
+  }
+  CHECK_EQUAL(0u, m.erase(safe_int(0)));
+  CHECK_EQUAL(50u, m.size());
+  for (int i = 0; i < 100; ++i) {
+    CHECK_EQUAL(i % 2 == 1, m.contains(safe_int(i)));
+  }
+  for (auto it = m.begin(); it != m.end(); ) it = m.erase(it);
+  CHECK_EQUAL(true, m.empty());
+}
+
+TEST(churn) {
+  // Repeated insert and erase must reuse tombstones rather than grow forever
+  opaque::flat_map<safe_int, int> m;
+  for (int i = 0; i < 100000; ++i) {
+    m[safe_int(i)] = i;
+    if (i >= 10) m.erase(safe_int(i - 10));
+  }
+  CHECK_EQUAL(10u, m.size());
+  CHECK_EQUAL(true, m.capacity() <= 64u);
+}
+
+TEST(iteration) {
+  opaque::flat_map<safe_int, int> m;
+  long sum = 0;
+  for (int i = 0; i < 300; ++i) { m[safe_int(i)] = i; sum += i; }
+  long seen = 0;
+  std::size_t n = 0;
+  for (const auto& [k, v] : m) { seen += k.value; CHECK_EQUAL(k.value, v); ++n; }
+  CHECK_EQUAL(m.size(), n);
+  CHECK_EQUAL(sum, seen);
+}
+
+TEST(strings) {
+  opaque::flat_map<a_string, int> m{ {a_string("one"), 1}, {a_string("two"), 2} };
+  opaque::flat_map<a_string, int> copy(m);
+  m.clear();
+  CHECK_EQUAL(true, m.empty());
+  CHECK_EQUAL(2, copy.at(a_string("two")));
+  try {
+    copy.at(a_string("three"));
+    CHECK_CATCH(std::out_of_range, e);
+  }
+  opaque::flat_map<a_string, int> moved(std::move(copy));
+  CHECK_EQUAL(1, moved[a_string("one")]);
+}
+
+TEST(resize_throws) {
+  // A copy that throws while the table grows leaves the map unchanged
+  opaque::flat_map<fragile_key, std::string, fragile_hash> m;
+  int n = 0;
+  for (; m.size() < m.capacity() * 7 / 8 or m.size() < 10; ++n) {
+    m.try_emplace(fragile_key(n), std::to_string(n));
+  }
+  const std::size_t capacity = m.capacity();
+  for (; m.capacity() == capacity; ++n) {
+    const std::size_t size = m.size();
+    fragile_key::copies_left = 5;
+    try {
+      m.try_emplace(fragile_key(n), std::to_string(n));
+      fragile_key::copies_left = -1;
+      CHECK_EQUAL(size + 1, m.size());
+    } catch (const std::runtime_error&) {
+      fragile_key::copies_left = -1;
+      CHECK_EQUAL(size, m.size());
+      CHECK_EQUAL(capacity, m.capacity());
+      break;
+    }
+  }
+  fragile_key::copies_left = -1;
+  CHECK_EQUAL(capacity, m.capacity());
+  for (int i = 0; i < n; ++i) {
+    CHECK_EQUAL(std::to_string(i), m.at(fragile_key(i)));
+  }
+  m.try_emplace(fragile_key(n), std::to_string(n));
+  CHECK(m.capacity() > capacity);
+  for (int i = 0; i <= n; ++i) {
+    CHECK_EQUAL(std::to_string(i), m.at(fragile_key(i)));
+  }
+}
+
+TEST(construction_throws) {
+  // A copy that throws during construction destroys what was built
+  {
+    opaque::flat_map<safe_int, fragile_value> m;
+    for (int i = 0; i < 100; ++i) m.try_emplace(safe_int(i), i);
+    CHECK_EQUAL(100, fragile_value::live);
+    fragile_value::copies_left = 50;
+    try {
+      opaque::flat_map<safe_int, fragile_value> copy(m);
+      CHECK(false);
+    } catch (const std::runtime_error&) { }
+    fragile_value::copies_left = -1;
+    CHECK_EQUAL(100, fragile_value::live);
+  }
+  CHECK_EQUAL(0, fragile_value::live);
+  {
+    const fragile_value a(1), b(2), c(3);
+    fragile_value::copies_left = 4;
+    try {
+      opaque::flat_map<safe_int, fragile_value> m{
+        {safe_int(1), a}, {safe_int(2), b}, {safe_int(3), c} };
+      CHECK(false);
+    } catch (const std::runtime_error&) { }
+    fragile_value::copies_left = -1;
+    CHECK_EQUAL(3, fragile_value::live);
+  }
+  CHECK_EQUAL(0, fragile_value::live);
+}
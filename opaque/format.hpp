@@ -0,0 +1,131 @@
+#ifndef OPAQUE_FORMAT_HPP
+#define OPAQUE_FORMAT_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/storage.hpp"
+#include <string_view>
+#include <type_traits>
+#include <version>
+#if defined(__cpp_lib_format)
+#include <algorithm>
+#include <format>
+#include <ranges>
+#endif
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Name written before the value when formatting an opaque typedef
+///
+/// Empty by default, so a typedef formats exactly as its underlying value.
+/// Specialize it, normally with OPAQUE_FORMAT_NAMED, to format a value as
+/// name(value) instead.
+///
+template <typename O>
+inline constexpr std::string_view format_name{};
+
+/// @}
+
+}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Format an opaque typedef as its name followed by its parenthesized value
+///
+/// This macro must be used outside any namespace, like OPAQUE_HASHABLE.
+///
+#define OPAQUE_FORMAT_NAMED(name) \
+  template <> inline constexpr std::string_view opaque::format_name<name> = #name;
+
+/// @}
+
+#if defined(__cpp_lib_format)
+
+namespace opaque {
+namespace detail {
+
+template <typename O>
+concept formattable_typedef = std::is_base_of_v<opaque_tag, O>
+  and std::is_same_v<O, typename O::opaque_type>;
+
+}
+}
+
+namespace std {
+
+///
+/// std::format support for all opaque typedefs
+///
+/// The format specification is that of the underlying type and is parsed by
+/// its formatter, so {:>8} or {:x} mean the same for an opaque typedef as
+/// for its value.  Output goes straight to the format context, so
+/// std::format_to into a fixed buffer does not allocate.
+///
+template <typename O, typename CharT>
+requires opaque::detail::formattable_typedef<O>
+struct formatter<O, CharT> : formatter<typename O::underlying_type, CharT> {
+
+  template <typename FormatContext>
+  auto format(const O& o, FormatContext& ctx) const {
+    using base = formatter<typename O::underlying_type, CharT>;
+    constexpr std::string_view name = opaque::format_name<O>;
+    if constexpr (name.empty()) {
+      return base::format(o.value, ctx);
+    } else {
+      auto out = std::copy(name.begin(), name.end(), ctx.out());
+      *out++ = CharT('(');
+      ctx.advance_to(out);
+      out = base::format(o.value, ctx);
+      *out++ = CharT(')');
+      return out;
+    }
+  }
+};
+
+#if defined(__cpp_lib_format_ranges)
+//
+// String typedefs are ranges; format them as their value, not as a range.
+// format_kind may be specialized only for ranges, so other typedefs are
+// left alone.
+//
+template <typename O>
+requires opaque::detail::formattable_typedef<O> and ranges::input_range<O>
+inline constexpr range_format format_kind<O> = range_format::disabled;
+#endif
+
+}
+
+#endif
+
+#endif
@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/format.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/string_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <string>
+
+UNIT_TEST_MAIN
+
+struct user_id : opaque::numeric_typedef<std::uint64_t, user_id> {
+  using base = opaque::numeric_typedef<std::uint64_t, user_id>;
+  using base::base;
+};
+
+struct price : opaque::numeric_typedef<double, price> {
+  using base = opaque::numeric_typedef<double, price>;
+  using base::base;
+};
+
+struct symbol : opaque::experimental::string_typedef<std::string, symbol> {
+  using base = opaque::experimental::string_typedef<std::string, symbol>;
+  using base::base;
+};
+
+OPAQUE_FORMAT_NAMED(user_id)
+
+static_assert(opaque::format_name<user_id> == "user_id");
+static_assert(opaque::format_name<price>.empty());
+
+#if defined(__cpp_lib_format)
+
+TEST(plain) {
+  CHECK_EQUAL(std::string("1.50"), std::format("{:.2f}", price(1.5)));
+  CHECK_EQUAL(std::string("  AAPL"), std::format("{:>6}", symbol("AAPL")));
+  CHECK_EQUAL(std::string("AAPL 1.5"),
+      std::format("{} {}", symbol("AAPL"), price(1.5)));
+}
+
+TEST(named) {
+  CHECK_EQUAL(std::string("user_id(ff)"), std::format("{:x}", user_id(255u)));
+}
+
+TEST(fixed_buffer) {
+  char buf[32];
+  const auto r = std::format_to_n(buf, sizeof(buf), "{}|{:08.3f}",
+      user_id(7u), price(2.5));
+  CHECK_EQUAL(std::string_view("user_id(7)|0002.500"),
+      std::string_view(buf, r.out));
+}
+
+#if defined(__cpp_lib_format_ranges)
+static_assert(std::format_kind<symbol> == std::range_format::disabled);
+#endif
+
+TEST(string_typedef_is_not_a_range) {
+  CHECK_EQUAL(std::string("AAPL"), std::format("{}", symbol("AAPL")));
+  CHECK_EQUAL(std::string("[AAPL]"), std::format("[{:.4}]", symbol("AAPLX")));
+}
+
+#else
+
+TEST(unsupported) {
+  // The standard library lacks <format>; only the naming trait is available
+  CHECK(opaque::format_name<symbol>.empty());
+}
+
+#endif
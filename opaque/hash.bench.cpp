@@ -0,0 +1,122 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/flat_map.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+struct id_identity : opaque::numeric_typedef<std::uint64_t, id_identity> {
+  using base = opaque::numeric_typedef<std::uint64_t, id_identity>;
+  using base::base;
+};
+struct id_mix : opaque::numeric_typedef<std::uint64_t, id_mix> {
+  using base = opaque::numeric_typedef<std::uint64_t, id_mix>;
+  using base::base;
+};
+struct id_seeded : opaque::numeric_typedef<std::uint64_t, id_seeded> {
+  using base = opaque::numeric_typedef<std::uint64_t, id_seeded>;
+  using base::base;
+};
+struct id_salted : opaque::numeric_typedef<std::uint64_t, id_salted> {
+  using base = opaque::numeric_typedef<std::uint64_t, id_salted>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(id_identity)
+OPAQUE_HASHABLE(id_mix, opaque::hash_policy::mix)
+OPAQUE_HASHABLE(id_seeded, opaque::hash_policy::seeded<>)
+OPAQUE_HASHABLE_SALTED(id_salted, opaque::hash_policy::mix)
+
+//
+// Probe lengths of a plain linear-probing table that takes the low bits of
+// the hash as the home slot, at a load factor of one half.
+//
+template <typename O>
+void probe_lengths(const char * policy, const char * keys,
+    const std::vector<std::uint64_t>& values) {
+  std::size_t capacity = 1;
+  while (capacity < 2 * values.size()) capacity *= 2;
+  std::vector<char> used(capacity, 0);
+  std::size_t total = 0, longest = 0;
+  for (auto v : values) {
+    std::size_t i = std::hash<O>{}(O(v)) & (capacity - 1);
+    std::size_t probes = 1;
+    while (used[i]) { i = (i + 1) & (capacity - 1); ++probes; }
+    used[i] = 1;
+    total += probes;
+    longest = std::max(longest, probes);
+  }
+  std::printf("%-10s %-12s mean probes %10.2f   max probes %10zu\n", policy,
+      keys, static_cast<double>(total) / static_cast<double>(values.size()),
+      longest);
+}
+
+template <typename O>
+void lookups(const char * policy, const std::vector<std::uint64_t>& values) {
+  opaque::flat_map<O, std::uint64_t> m(values.size());
+  for (auto v : values) m.try_emplace(O(v), v);
+  char label[128];
+  std::snprintf(label, sizeof(label), "flat_map lookup, %s", policy);
+  measure(label, values.size(), [&] {
+    std::uint64_t sum = 0;
+    for (auto v : values) {
+      if (auto it = m.find(O(v)); it != m.end()) sum += it->second;
+    }
+    keep(sum);
+  });
+}
+
+template <typename O>
+void all(const char * policy, const std::vector<std::uint64_t>& sequential,
+    const std::vector<std::uint64_t>& strided,
+    const std::vector<std::uint64_t>& random) {
+  probe_lengths<O>(policy, "sequential", sequential);
+  probe_lengths<O>(policy, "strided", strided);
+  probe_lengths<O>(policy, "random", random);
+  lookups<O>(policy, random);
+}
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 200000);
+  std::vector<std::uint64_t> sequential, strided, random;
+  std::mt19937_64 rng(7);
+  for (std::size_t i = 0; i < n; ++i) {
+    sequential.push_back(i);
+    strided.push_back(i * 4096);
+    random.push_back(rng());
+  }
+  all<id_identity>("identity", sequential, strided, random);
+  all<id_mix     >("mix"     , sequential, strided, random);
+  all<id_seeded  >("seeded"  , sequential, strided, random);
+  all<id_salted  >("salted"  , sequential, strided, random);
+}
@@ -1,7 +1,7 @@
 #ifndef OPAQUE_HASH_HPP
 #define OPAQUE_HASH_HPP
 //
-// Copyright (c) 2016, 2021
+// Copyright (c) 2016, 2021, 2026
 // Kyle Markley.  All rights reserved.
 //
 // Redistribution and use in source and binary forms, with or without
@@ -29,7 +29,253 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 #include "opaque/storage.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <string_view>
+#include <type_traits>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+///
+/// MurmurHash3 fmix64 finalizer
+///
+/// Two rounds of multiply-xorshift.  Flipping any input bit flips each
+/// output bit with probability close to one half.
+///
+constexpr std::uint64_t mix64(std::uint64_t x) noexcept {
+  x ^= x >> 33;
+  x *= 0xff51afd7ed558ccdu;
+  x ^= x >> 33;
+  x *= 0xc4ceb9fe1a85ec53u;
+  x ^= x >> 33;
+  return x;
+}
+
+/// Full 64x64 -> 128 bit multiply, folded back to 64 bits
+constexpr std::uint64_t mum(std::uint64_t a, std::uint64_t b) noexcept {
+  const std::uint64_t alo = a & 0xffffffffu, ahi = a >> 32;
+  const std::uint64_t blo = b & 0xffffffffu, bhi = b >> 32;
+  const std::uint64_t ll = alo * blo, lh = alo * bhi;
+  const std::uint64_t hl = ahi * blo, hh = ahi * bhi;
+  const std::uint64_t mid = (ll >> 32) + (lh & 0xffffffffu) + (hl & 0xffffffffu);
+  const std::uint64_t lo = (mid << 32) | (ll & 0xffffffffu);
+  const std::uint64_t hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+  return lo ^ hi;
+}
+
+template <typename C>
+constexpr std::uint64_t read_le(const C * p, unsigned n) noexcept {
+  std::uint64_t r = 0;
+  for (unsigned i = 0; i < n; ++i) {
+    r |= std::uint64_t{static_cast<unsigned char>(p[i])} << (8 * i);
+  }
+  return r;
+}
+
+///
+/// Seeded hash of a byte string, in the style of wyhash
+///
+/// The loads are assembled bytewise so that this is usable in constant
+/// expressions; optimizers turn them back into plain loads.
+///
+template <typename C>
+constexpr std::uint64_t hash_bytes(const C * p, std::size_t len,
+    std::uint64_t seed) noexcept {
+  static_assert(sizeof(C) == 1);
+  constexpr std::uint64_t s0 = 0xa0761d6478bd642fu;
+  constexpr std::uint64_t s1 = 0xe7037ed1a0b428dbu;
+  constexpr std::uint64_t s2 = 0x8ebc6af09c88c6e3u;
+  constexpr std::uint64_t s3 = 0x589965cc75374cc3u;
+  seed ^= mum(seed ^ s0, s1);
+  std::uint64_t a = 0, b = 0;
+  if (len <= 16) {
+    if (len >= 4) {
+      const std::size_t q = (len >> 3) << 2;
+      a = (read_le(p, 4) << 32) | read_le(p + q, 4);
+      b = (read_le(p + len - 4, 4) << 32) | read_le(p + len - 4 - q, 4);
+    } else if (len > 0) {
+      a = (std::uint64_t{static_cast<unsigned char>(p[0])} << 16)
+        | (std::uint64_t{static_cast<unsigned char>(p[len >> 1])} << 8)
+        |  std::uint64_t{static_cast<unsigned char>(p[len - 1])};
+    }
+  } else {
+    std::size_t i = len;
+    if (i > 48) {
+      std::uint64_t see1 = seed, see2 = seed;
+      do {
+        seed = mum(read_le(p     , 8) ^ s1, read_le(p +  8, 8) ^ seed);
+        see1 = mum(read_le(p + 16, 8) ^ s2, read_le(p + 24, 8) ^ see1);
+        see2 = mum(read_le(p + 32, 8) ^ s3, read_le(p + 40, 8) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = mum(read_le(p, 8) ^ s1, read_le(p + 8, 8) ^ seed);
+      p += 16;
+      i -= 16;
+    }
+    a = read_le(p + i - 16, 8);
+    b = read_le(p + i -  8, 8);
+  }
+  return mum(s1 ^ len, mum(a ^ s1, b ^ seed));
+}
+
+template <typename U>
+concept hashable_as_bytes = requires(const U& u) {
+  typename U::traits_type;
+  { u.data() } -> std::convertible_to<const typename U::value_type *>;
+  { u.size() } -> std::convertible_to<std::size_t>;
+} and sizeof(typename U::value_type) == 1;
+
+template <typename U>
+concept hashable_as_word = (std::is_integral_v<U> or std::is_enum_v<U>)
+  and sizeof(U) <= sizeof(std::uint64_t);
+
+template <typename U>
+constexpr std::uint64_t word_of(const U& u) noexcept {
+  if constexpr (std::is_enum_v<U>) {
+    return static_cast<std::uint64_t>(static_cast<std::underlying_type_t<U>>(u));
+  } else {
+    return static_cast<std::uint64_t>(u);
+  }
+}
+
+template <typename H>
+concept avalanching_hash = requires { requires H::avalanching; };
+
+///
+/// An underlying type that carries its own hash, such as the one of
+/// hashed_string_typedef; its static member "avalanching" describes it
+///
+template <typename U>
+concept caches_hash = requires(const U& u) {
+  { u.cached_hash() } -> std::convertible_to<std::size_t>;
+  { U::avalanching } -> std::convertible_to<bool>;
+};
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Hash policies for OPAQUE_HASHABLE
+///
+/// A policy is a function object hashing an underlying value together with
+/// a salt.  Its static member "avalanching" says whether every output bit
+/// depends on every input bit; hash tables such as opaque::flat_map use that
+/// to skip their own bit mixing.
+///
+namespace hash_policy {
+
+///
+/// Forward to std::hash, which is the identity for integers in common
+/// standard libraries
+///
+struct identity {
+  static constexpr bool avalanching = false;
+  template <typename U>
+  std::size_t operator()(const U& u, std::uint64_t salt = 0) const {
+    return std::hash<U>{}(u) ^ static_cast<std::size_t>(salt);
+  }
+};
+
+///
+/// Multiply-xorshift mixing of integers, or of std::hash for other types
+///
+struct mix {
+  static constexpr bool avalanching = true;
+  template <typename U>
+  constexpr std::size_t operator()(const U& u, std::uint64_t salt = 0) const {
+    if constexpr (detail::hashable_as_word<U>) {
+      return static_cast<std::size_t>(detail::mix64(detail::word_of(u) ^ salt));
+    } else {
+      return static_cast<std::size_t>(detail::mix64(
+            static_cast<std::uint64_t>(std::hash<U>{}(u)) ^ salt));
+    }
+  }
+};
+
+///
+/// Seeded wyhash-style hash of strings of bytes
+///
+/// Types that are not strings of bytes use the mix policy.  Equal contents
+/// hash equally regardless of the string type, so a std::string and a
+/// std::string_view of the same bytes agree.
+///
+template <std::uint64_t seed = 0x2d358dccaa6c78a5u>
+struct seeded {
+  static constexpr bool avalanching = true;
+  template <typename U>
+  constexpr std::size_t operator()(const U& u, std::uint64_t salt = 0) const {
+    if constexpr (detail::hashable_as_bytes<U>) {
+      return static_cast<std::size_t>(
+          detail::hash_bytes(u.data(), u.size(), seed ^ salt));
+    } else {
+      return mix{}(u, seed ^ salt);
+    }
+  }
+};
+
+/// Choose the default policy when none is named
+template <typename P = identity>
+using select = P;
+
+///
+/// Apply policy P to u, unless u caches its hash
+///
+/// A cached hash is returned as is, or mixed with a nonzero salt, so the
+/// policy named for such a type is ignored.
+///
+template <typename P, typename U>
+constexpr std::size_t apply(const U& u, std::uint64_t salt) {
+  if constexpr (detail::caches_hash<U>) {
+    const auto h = static_cast<std::size_t>(u.cached_hash());
+    return salt == 0 ? h : static_cast<std::size_t>(
+        detail::mix64(static_cast<std::uint64_t>(h) ^ salt));
+  } else {
+    return P{}(u, salt);
+  }
+}
+
+/// Whether apply<P, U> is avalanching
+template <typename P, typename U>
+constexpr bool avalanches() noexcept {
+  if constexpr (detail::caches_hash<U>) {
+    return U::avalanching;
+  } else {
+    return P::avalanching;
+  }
+}
+
+///
+/// Derive a salt from a name (64-bit FNV-1a)
+///
+constexpr std::uint64_t salt_of(std::string_view name) noexcept {
+  std::uint64_t h = 0xcbf29ce484222325u;
+  for (char c : name) {
+    h ^= static_cast<unsigned char>(c);
+    h *= 0x100000001b3u;
+  }
+  return h;
+}
+
+}
+
+/// @}
+
+}
 
 /// \addtogroup miscellaneous
 /// @{
@@ -37,16 +283,38 @@
 ///
 /// Create a std::hash specialization for an opaque typedef
 ///
+/// An optional second argument names a hash policy from opaque::hash_policy
+/// (or a compatible function object).  The default, hash_policy::identity,
+/// forwards to std::hash of the underlying type.  Typedefs whose
+/// underlying value caches its hash, like hashed_string_typedef, return
+/// that hash whatever the policy.
+///
 /// This macro must be used outside any namespace, because it creates a
 /// specialization in std.
 ///
-#define OPAQUE_HASHABLE(name) \
+#define OPAQUE_HASHABLE(name, ...) \
+  OPAQUE_HASHABLE_SALT(name, 0, __VA_ARGS__)
+
+///
+/// Create a std::hash specialization salted by the name of the typedef
+///
+/// Distinct typedefs with equal underlying values hash differently, which
+/// keeps keys of one type from predictably colliding with those of another
+/// in a shared table.
+///
+#define OPAQUE_HASHABLE_SALTED(name, ...) \
+  OPAQUE_HASHABLE_SALT(name, opaque::hash_policy::salt_of(#name), __VA_ARGS__)
+
+#define OPAQUE_HASHABLE_SALT(name, salt, ...) \
 namespace std {\
   template <> struct hash<name> {\
     using argument_type = typename name::opaque_type;\
     using result_type = size_t;\
+    using policy_type = opaque::hash_policy::select<__VA_ARGS__>;\
+    static constexpr bool avalanching = opaque::hash_policy::avalanches<\
+      policy_type, decltype(argument_type::value)>();\
     result_type operator()(const argument_type& key) const {\
-      return std::hash<typename name::underlying_type>{}(key.value);\
+      return opaque::hash_policy::apply<policy_type>(key.value, salt);\
     }\
   };\
 }
@@ -1,5 +1,5 @@
 //
-// Copyright (c) 2016, 2021
+// Copyright (c) 2016, 2021, 2026
 // Kyle Markley.  All rights reserved.
 //
 // Redistribution and use in source and binary forms, with or without
@@ -30,7 +30,12 @@
 #include "opaque/string_typedef.hpp"
 #include "opaque/hash.hpp"
 #include "arrtest/arrtest.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string_view>
 #include <unordered_set>
+#include <vector>
 
 UNIT_TEST_MAIN
 
@@ -44,8 +49,34 @@ struct a_string : opaque::experimental::string_typedef<std::string, a_string> {
   using base::base;
 };
 
+struct mixed_int : opaque::numeric_typedef<int, mixed_int> {
+  using base = opaque::numeric_typedef<int, mixed_int>;
+  using base::base;
+};
+
+struct salted_int : opaque::numeric_typedef<int, salted_int> {
+  using base = opaque::numeric_typedef<int, salted_int>;
+  using base::base;
+};
+
+struct seeded_string
+  : opaque::experimental::string_typedef<std::string, seeded_string> {
+  using base = opaque::experimental::string_typedef<std::string, seeded_string>;
+  using base::base;
+};
+
 OPAQUE_HASHABLE(safe_int)
 OPAQUE_HASHABLE(a_string)
+OPAQUE_HASHABLE(mixed_int, opaque::hash_policy::mix)
+OPAQUE_HASHABLE_SALTED(salted_int, opaque::hash_policy::mix)
+OPAQUE_HASHABLE(seeded_string, opaque::hash_policy::seeded<>)
+
+static_assert(not std::hash<safe_int     >::avalanching);
+static_assert(    std::hash<mixed_int    >::avalanching);
+static_assert(    std::hash<seeded_string>::avalanching);
+static_assert(opaque::hash_policy::mix{}(1) != opaque::hash_policy::mix{}(2));
+static_assert(opaque::hash_policy::seeded<>{}(std::string_view("abc")) !=
+              opaque::hash_policy::seeded<>{}(std::string_view("abd")));
 
 TEST(numeric) {
   std::unordered_set<safe_int> s;
@@ -56,3 +87,60 @@ TEST(string) {
   std::unordered_set<a_string> s;
   s.emplace("Hello");
 }
+
+TEST(identity) {
+  CHECK_EQUAL(std::hash<int>{}(42), std::hash<safe_int>{}(safe_int(42)));
+}
+
+TEST(mix) {
+  // Sequential values must not stay sequential in the low bits
+  std::unordered_set<std::size_t> low_bits;
+  for (int i = 0; i < 64; ++i) {
+    low_bits.insert(std::hash<mixed_int>{}(mixed_int(i)) & 0xff);
+  }
+  CHECK(low_bits.size() > 32);
+}
+
+TEST(mix_avalanche) {
+  // Each input bit flips each output bit in about half of all inputs
+  std::mt19937_64 rng(1);
+  constexpr int samples = 1000;
+  std::vector<int> flips(64 * 64);
+  for (int n = 0; n < samples; ++n) {
+    const std::uint64_t x = rng();
+    const std::uint64_t hx = opaque::detail::mix64(x);
+    for (int i = 0; i < 64; ++i) {
+      const std::uint64_t d = hx ^ opaque::detail::mix64(x ^ (1ull << i));
+      for (int j = 0; j < 64; ++j) {
+        flips[static_cast<std::size_t>(i * 64 + j)] += int((d >> j) & 1u);
+      }
+    }
+  }
+  const auto [lo, hi] = std::minmax_element(flips.begin(), flips.end());
+  CHECK(*lo > samples * 4 / 10);
+  CHECK(*hi < samples * 6 / 10);
+}
+
+TEST(salted) {
+  CHECK_UNEQUAL(std::hash<mixed_int>{}(mixed_int(7)),
+                std::hash<salted_int>{}(salted_int(7)));
+  CHECK_EQUAL(std::hash<salted_int>{}(salted_int(7)),
+              std::hash<salted_int>{}(salted_int(7)));
+}
+
+TEST(seeded) {
+  // Strings and views of the same bytes agree, for every length class
+  using policy = opaque::hash_policy::seeded<>;
+  const std::string text(100, 'x');
+  for (std::size_t n = 0; n <= text.size(); ++n) {
+    const std::string s = text.substr(0, n);
+    CHECK_EQUAL(policy{}(std::string_view(s)), policy{}(s));
+  }
+  CHECK_EQUAL(policy{}(std::string("Hello")),
+              std::hash<seeded_string>{}(seeded_string("Hello")));
+  CHECK_UNEQUAL(policy{}(std::string("Hello")),
+                opaque::hash_policy::seeded<1>{}(std::string("Hello")));
+  std::unordered_set<seeded_string> s;
+  s.emplace("Hello");
+  CHECK_EQUAL(1u, s.count(seeded_string("Hello")));
+}
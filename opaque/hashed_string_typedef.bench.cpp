@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/hashed_string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+struct request_path
+  : opaque::experimental::safer_string_typedef<std::string, request_path> {
+  using base =
+    opaque::experimental::safer_string_typedef<std::string, request_path>;
+  using base::base;
+};
+
+struct hashed_path
+  : opaque::experimental::hashed_string_typedef<hashed_path> {
+  using base = opaque::experimental::hashed_string_typedef<hashed_path>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(request_path, opaque::hash_policy::seeded<>)
+OPAQUE_HASHABLE(hashed_path)
+
+// Each key passes through several hash-based stages, as in a pipeline
+template <typename K>
+std::size_t pipeline(const std::vector<K>& keys,
+    const std::unordered_map<K, std::size_t>& routes) {
+  std::unordered_set<K> dedup;
+  dedup.reserve(routes.size());
+  std::size_t total = 0;
+  for (const auto& k : keys) {
+    if (dedup.insert(k).second) ++total;
+    total += std::hash<K>{}(k) % 16;
+    const auto it = routes.find(k);
+    if (it != routes.end()) total += it->second;
+  }
+  return total;
+}
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 2000000);
+  constexpr std::size_t distinct = 4096;
+
+  std::vector<std::string> text;
+  for (std::size_t i = 0; i < distinct; ++i) {
+    text.push_back("/api/v2/tenants/acme-corporation/resources/items/"
+        + std::to_string(i * 7919));
+  }
+  std::vector<request_path> plain;
+  std::vector<hashed_path> hashed;
+  std::unordered_map<request_path, std::size_t> plain_routes;
+  std::unordered_map<hashed_path, std::size_t> hashed_routes;
+  for (std::size_t i = 0; i < n; ++i) {
+    plain.emplace_back(text[(i * 31) % distinct]);
+    hashed.emplace_back(text[(i * 31) % distinct]);
+  }
+  for (std::size_t i = 0; i < distinct; i += 2) {
+    plain_routes.emplace(request_path(text[i]), i);
+    hashed_routes.emplace(hashed_path(text[i]), i);
+  }
+
+  measure("safer_string_typedef construct", distinct, [&] {
+    for (const auto& t : text) keep(request_path(t));
+  });
+  measure("hashed_string_typedef construct", distinct, [&] {
+    for (const auto& t : text) keep(hashed_path(t));
+  });
+  measure("safer_string_typedef hash", n, [&] {
+    std::size_t h = 0;
+    for (const auto& k : plain) h ^= std::hash<request_path>{}(k);
+    keep(h);
+  });
+  measure("hashed_string_typedef hash", n, [&] {
+    std::size_t h = 0;
+    for (const auto& k : hashed) h ^= std::hash<hashed_path>{}(k);
+    keep(h);
+  });
+  measure("safer_string_typedef map lookup", n, [&] {
+    std::size_t found = 0;
+    for (const auto& k : plain) found += plain_routes.count(k);
+    keep(found);
+  });
+  measure("hashed_string_typedef map lookup", n, [&] {
+    std::size_t found = 0;
+    for (const auto& k : hashed) found += hashed_routes.count(k);
+    keep(found);
+  });
+  measure("safer_string_typedef dedup+hash+lookup", n, [&] {
+    keep(pipeline(plain, plain_routes));
+  });
+  measure("hashed_string_typedef dedup+hash+lookup", n, [&] {
+    keep(pipeline(hashed, hashed_routes));
+  });
+}
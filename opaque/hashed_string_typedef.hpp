@@ -0,0 +1,169 @@
+#ifndef OPAQUE_HASHED_STRING_TYPEDEF_HPP
+#define OPAQUE_HASHED_STRING_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/storage.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/safer_string_typedef.hpp"
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+///
+/// A string together with its hash under policy P
+///
+/// The text is reachable only through const accessors, so the hash cannot
+/// go stale.  Equality rejects on a hash mismatch before comparing text;
+/// ordering is that of the text.
+///
+template <typename S, typename P>
+class hashed_string {
+public:
+  using string_type = S;
+  static constexpr bool avalanching = P::avalanching;
+
+  hashed_string() : hashed_string(S()) { }
+
+  explicit hashed_string(S s)
+    : text_(std::move(s)), hash_(P{}(text_, 0)) { }
+
+  const S& text() const noexcept { return text_; }
+  std::size_t cached_hash() const noexcept { return hash_; }
+
+  friend bool operator==(const hashed_string& a, const hashed_string& b)
+    noexcept {
+    return a.hash_ == b.hash_ and a.text_ == b.text_;
+  }
+  friend auto operator<=>(const hashed_string& a, const hashed_string& b)
+    noexcept {
+    return a.text_ <=> b.text_;
+  }
+
+private:
+  S text_;
+  std::size_t hash_;
+};
+
+}
+
+/// @}
+
+namespace experimental {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Immutable string typedef that stores its hash next to its text
+///
+/// Suited to keys that are hashed many times after construction, on their
+/// way through deduplication, partitioning and map lookups.  The hash is
+/// computed once by the constructor, using policy P from opaque::hash_policy;
+/// std::hash specializations made with OPAQUE_HASHABLE return it without
+/// reading the text, and == compares text only when the hashes agree.
+///
+/// The cost is one word per instance and a hash per construction, so this
+/// pays off only for keys hashed or compared more often than constructed.
+/// There are no mutating members; assign a new instance instead.
+///
+/// Conversion from and to safer_string_typedef instances is explicit and
+/// copies the text.
+///
+/// Template arguments:
+///  -# O : The result type, your subclass
+///  -# S : The string type
+///  -# P : The hash policy, by default the seeded byte-string hash
+///
+template <typename O, typename S = std::string,
+         typename P = hash_policy::seeded<>>
+struct hashed_string_typedef : opaque_storage<detail::hashed_string<S,P>, O> {
+private:
+  using base = opaque_storage<detail::hashed_string<S,P>, O>;
+public:
+  using underlying_type = detail::hashed_string<S,P>;
+  using     opaque_type = O;
+  using base::value;
+
+  using string_type    = S;
+  using traits_type    = typename S::traits_type;
+  using value_type     = typename S::value_type;
+  using size_type      = typename S::size_type;
+  using view_type      = std::basic_string_view<value_type, traits_type>;
+  using const_iterator = typename S::const_iterator;
+
+  /// The empty string
+  hashed_string_typedef() = default;
+
+  explicit hashed_string_typedef(S s) : base(std::move(s)) { }
+
+  explicit hashed_string_typedef(view_type s) : base(S(s)) { }
+
+  explicit hashed_string_typedef(const value_type * s) : base(S(s)) { }
+
+  template <typename R>
+  explicit hashed_string_typedef(const safer_string_typedef<S,R>& s)
+    : base(s.value) { }
+
+  /// Copy the text into a safer_string_typedef
+  template <typename R>
+    requires std::derived_from<R, safer_string_typedef<S, R>>
+  explicit operator R() const {
+    return R(value.text());
+  }
+
+  /// The hash computed at construction
+  std::size_t hash() const noexcept { return value.cached_hash(); }
+
+  const S&             str() const noexcept { return value.text(); }
+  view_type           view() const noexcept { return value.text(); }
+  const value_type * c_str() const noexcept { return value.text().c_str(); }
+  const value_type *  data() const noexcept { return value.text().data(); }
+  size_type           size() const noexcept { return value.text().size(); }
+  bool               empty() const noexcept { return value.text().empty(); }
+
+  const_iterator begin() const noexcept { return value.text().begin(); }
+  const_iterator   end() const noexcept { return value.text().end();   }
+};
+
+/// @}
+
+}
+}
+
+#endif
@@ -0,0 +1,138 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/hashed_string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/flat_map.hpp"
+#include "arrtest/arrtest.hpp"
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+
+UNIT_TEST_MAIN
+
+struct route_key : opaque::experimental::hashed_string_typedef<route_key> {
+  using base = opaque::experimental::hashed_string_typedef<route_key>;
+  using base::base;
+};
+
+struct tenant_key : opaque::experimental::hashed_string_typedef<tenant_key> {
+  using base = opaque::experimental::hashed_string_typedef<tenant_key>;
+  using base::base;
+};
+
+struct route_name
+  : opaque::experimental::safer_string_typedef<std::string, route_name> {
+  using base =
+    opaque::experimental::safer_string_typedef<std::string, route_name>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(route_key)
+OPAQUE_HASHABLE_SALTED(tenant_key)
+OPAQUE_HASHABLE(route_name, opaque::hash_policy::seeded<>)
+
+static_assert(not std::is_convertible_v<const char *, route_key>);
+static_assert(not std::is_convertible_v<std::string, route_key>);
+static_assert(not std::is_convertible_v<route_name, route_key>);
+static_assert(not std::is_convertible_v<route_key, route_name>);
+static_assert(not std::is_constructible_v<route_key, tenant_key>);
+static_assert(std::is_constructible_v<route_key, route_name>);
+static_assert(std::is_constructible_v<route_name, route_key>);
+static_assert(std::hash<route_key>::avalanching);
+
+TEST(construction) {
+  const route_key a("/api/v1/users"), b(std::string("/api/v1/users"));
+  const route_key c(std::string_view("/api/v1/orders")), d;
+  CHECK(a == b);
+  CHECK(a != c);
+  CHECK(a.view() == "/api/v1/users");
+  CHECK_EQUAL(13u, a.size());
+  CHECK_EQUAL('\0', a.c_str()[13]);
+  CHECK(std::string(c.begin(), c.end()) == "/api/v1/orders");
+  CHECK(d.empty());
+  CHECK(d == route_key(""));
+}
+
+TEST(cached_hash) {
+  const route_key a("/api/v1/users");
+  const route_name n("/api/v1/users");
+  // The cached hash is the policy's hash of the text
+  CHECK_EQUAL(std::hash<route_name>{}(n), a.hash());
+  CHECK_EQUAL(a.hash(), std::hash<route_key>{}(a));
+  CHECK_EQUAL(a.hash(), route_key(n).hash());
+  // Salting still separates types with equal text
+  const tenant_key t("/api/v1/users");
+  CHECK(std::hash<tenant_key>{}(t) != t.hash());
+  CHECK_EQUAL(std::hash<tenant_key>{}(t),
+              std::hash<tenant_key>{}(tenant_key("/api/v1/users")));
+}
+
+TEST(copies_keep_hash) {
+  route_key a("/health");
+  const std::size_t h = a.hash();
+  route_key b = a;
+  CHECK_EQUAL(h, b.hash());
+  route_key c = std::move(a);
+  CHECK_EQUAL(h, c.hash());
+  c = route_key("/metrics");
+  CHECK(c.view() == "/metrics");
+  CHECK_EQUAL(route_key("/metrics").hash(), c.hash());
+}
+
+TEST(comparison) {
+  const route_key a("abc"), b("abd"), c("abc");
+  CHECK(a < b);
+  CHECK(b > c);
+  CHECK(a <= c);
+  CHECK(a == c);
+  CHECK(not (a == b));
+}
+
+TEST(conversion) {
+  const route_name n("/login");
+  const route_key k(n);
+  const route_name back(k);
+  CHECK(back == n);
+}
+
+TEST(containers) {
+  std::unordered_set<route_key> seen;
+  for (int i = 0; i < 100; ++i) {
+    seen.insert(route_key("/item/" + std::to_string(i % 10)));
+  }
+  CHECK_EQUAL(10u, seen.size());
+  CHECK(seen.count(route_key("/item/3")) == 1);
+  CHECK(seen.count(route_key("/item/10")) == 0);
+
+  opaque::flat_map<route_key, int> m;
+  m[route_key("/a")] = 1;
+  m[route_key("/b")] = 2;
+  CHECK_EQUAL(2, m[route_key("/b")]);
+  CHECK_EQUAL(2u, m.size());
+}
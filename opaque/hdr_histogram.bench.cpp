@@ -0,0 +1,62 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/hdr_histogram.hpp"
+#include "opaque/timestamp.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 20000000);
+  std::mt19937_64 rng(5);
+  std::vector<opaque::duration> v;
+  v.reserve(4096);
+  for (int i = 0; i < 4096; ++i) {
+    // Latencies from 1 us to about 16 ms, log-uniform
+    v.emplace_back(static_cast<std::int64_t>(1000u << (rng() % 14)) +
+                   static_cast<std::int64_t>(rng() % 1000));
+  }
+
+  opaque::hdr_histogram<opaque::duration> h;
+  measure("record", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) h.record(v[i & 4095]);
+  });
+  measure("record_exclusive", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) h.record_exclusive(v[i & 4095]);
+  });
+  measure("percentile(99.9)", 1000, [&] {
+    for (int i = 0; i < 1000; ++i) keep(h.percentile(99.9));
+  });
+  opaque::hdr_histogram<opaque::duration> other;
+  measure("merge", 1000, [&] {
+    for (int i = 0; i < 1000; ++i) other.merge(h);
+  });
+  keep(other.count());
+}
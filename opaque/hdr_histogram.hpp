@@ -0,0 +1,230 @@
+#ifndef OPAQUE_HDR_HISTOGRAM_HPP
+#define OPAQUE_HDR_HISTOGRAM_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Log-linear histogram of durations (or any integral numeric typedef)
+///
+/// Each power of two is split into 2^Precision linear sub-buckets, so every
+/// recorded value is represented within a relative error of 2^-Precision
+/// (under 0.8% by default) across the whole 64-bit range.  Values below
+/// 2^(Precision+1) are counted exactly.  Negative values count as zero.
+///
+/// record() is a relaxed atomic increment of one counter, found with a
+/// shift and a count of leading zeros, so any thread may record into any
+/// histogram.  For the lowest overhead give each thread its own histogram,
+/// record with record_exclusive(), and merge() them when reporting.
+///
+/// Template arguments:
+///  -# Duration : A numeric typedef over an integer, e.g. opaque::duration
+///     or the distance type of a position_typedef
+///  -# Precision : Sub-bucket bits per power of two
+///
+template <typename Duration, unsigned Precision = 7>
+class hdr_histogram {
+  using raw_type = typename Duration::underlying_type;
+  static_assert(std::is_integral_v<raw_type> and sizeof(raw_type) <= 8,
+      "hdr_histogram requires an integer underlying type");
+  static_assert(Precision >= 1 and Precision <= 16);
+
+  static constexpr unsigned sub_buckets = 1u << Precision;
+  static constexpr std::uint64_t exact_limit = 2u * sub_buckets;
+
+public:
+  using value_type = Duration;
+  using size_type  = std::size_t;
+
+  /// Number of counters; each is eight bytes
+  static constexpr size_type bucket_count = (65 - Precision) << Precision;
+
+  hdr_histogram()
+    : counts_(std::make_unique<std::atomic<std::uint64_t>[]>(bucket_count)) { }
+
+  hdr_histogram(hdr_histogram&&) noexcept = default;
+  hdr_histogram& operator=(hdr_histogram&&) noexcept = default;
+
+  /// Count d, n times; safe to call concurrently from any thread
+  void record(const Duration& d, std::uint64_t n = 1) noexcept {
+    counts_[bucket_of(d)].fetch_add(n, std::memory_order_relaxed);
+  }
+
+  ///
+  /// Count d, n times, when no other thread records into this histogram
+  ///
+  /// This avoids a locked instruction.  Other threads may still read or
+  /// merge() this histogram concurrently.
+  ///
+  void record_exclusive(const Duration& d, std::uint64_t n = 1) noexcept {
+    auto& c = counts_[bucket_of(d)];
+    c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+  }
+
+  /// Add every count of other into this histogram
+  void merge(const hdr_histogram& other) noexcept {
+    for (size_type i = 0; i < bucket_count; ++i) {
+      const auto n = other.counts_[i].load(std::memory_order_relaxed);
+      if (n) counts_[i].fetch_add(n, std::memory_order_relaxed);
+    }
+  }
+
+  void reset() noexcept {
+    for (size_type i = 0; i < bucket_count; ++i) {
+      counts_[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  /// Number of values recorded
+  std::uint64_t count() const noexcept {
+    std::uint64_t total = 0;
+    for (size_type i = 0; i < bucket_count; ++i) total += load(i);
+    return total;
+  }
+
+  bool empty() const noexcept { return count() == 0; }
+
+  ///
+  /// The value at or below which p percent of recorded values fall
+  ///
+  /// The result is the highest value equivalent to the bucket holding that
+  /// rank, so it never understates a latency.  p is clamped to [0, 100];
+  /// an empty histogram gives Duration(0).
+  ///
+  Duration percentile(double p) const noexcept {
+    const std::uint64_t total = count();
+    if (total == 0) return Duration(raw_type(0));
+    p = std::clamp(p, 0.0, 100.0);
+    auto rank = static_cast<std::uint64_t>(
+        std::ceil(p / 100.0 * static_cast<double>(total)));
+    rank = std::clamp<std::uint64_t>(rank, 1, total);
+    std::uint64_t seen = 0;
+    for (size_type i = 0; i < bucket_count; ++i) {
+      seen += load(i);
+      if (seen >= rank) return to_duration(highest_in(i));
+    }
+    return max();
+  }
+
+  /// Lowest value equivalent to the smallest recorded value
+  Duration min() const noexcept {
+    for (size_type i = 0; i < bucket_count; ++i) {
+      if (load(i)) return to_duration(lowest_in(i));
+    }
+    return Duration(raw_type(0));
+  }
+
+  /// Highest value equivalent to the largest recorded value
+  Duration max() const noexcept {
+    for (size_type i = bucket_count; i-- > 0; ) {
+      if (load(i)) return to_duration(highest_in(i));
+    }
+    return Duration(raw_type(0));
+  }
+
+  /// Mean of the bucket midpoints, weighted by count
+  double mean() const noexcept {
+    double sum = 0;
+    std::uint64_t total = 0;
+    for (size_type i = 0; i < bucket_count; ++i) {
+      if (const auto n = load(i)) {
+        const double mid = (static_cast<double>(lowest_in(i)) +
+                            static_cast<double>(highest_in(i))) / 2;
+        sum += mid * static_cast<double>(n);
+        total += n;
+      }
+    }
+    return total ? sum / static_cast<double>(total) : 0.0;
+  }
+
+  ///
+  /// Bucket index of a value
+  ///
+  /// Values below 2^(Precision+1) map to themselves.  Above that, a value
+  /// is shifted right until it has Precision+1 significant bits, and the
+  /// shift selects the group of sub-buckets.
+  ///
+  static size_type bucket_of(const Duration& d) noexcept {
+    const std::uint64_t v = magnitude(d.value);
+    const auto shift = static_cast<unsigned>(
+        std::bit_width(v | (exact_limit - 1))) - (Precision + 1);
+    return (size_type{shift} << Precision) + (v >> shift);
+  }
+
+private:
+  static std::uint64_t magnitude(raw_type v) noexcept {
+    if constexpr (std::is_signed_v<raw_type>) {
+      if (v < 0) return 0;
+    }
+    return static_cast<std::uint64_t>(v);
+  }
+
+  static std::uint64_t lowest_in(size_type i) noexcept {
+    if (i < exact_limit) return i;
+    const auto shift = static_cast<unsigned>(i >> Precision) - 1;
+    return (sub_buckets + (i & (sub_buckets - 1))) << shift;
+  }
+
+  static std::uint64_t highest_in(size_type i) noexcept {
+    if (i < exact_limit) return i;
+    const auto shift = static_cast<unsigned>(i >> Precision) - 1;
+    return lowest_in(i) + ((std::uint64_t{1} << shift) - 1);
+  }
+
+  static Duration to_duration(std::uint64_t v) noexcept {
+    constexpr auto top =
+      static_cast<std::uint64_t>(std::numeric_limits<raw_type>::max());
+    return Duration(static_cast<raw_type>(std::min(v, top)));
+  }
+
+  std::uint64_t load(size_type i) const noexcept {
+    return counts_[i].load(std::memory_order_relaxed);
+  }
+
+  std::unique_ptr<std::atomic<std::uint64_t>[]> counts_;
+};
+
+/// @}
+
+}
+
+#endif
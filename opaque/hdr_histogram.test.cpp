@@ -0,0 +1,136 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/hdr_histogram.hpp"
+#include "opaque/timestamp.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <random>
+#include <thread>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+using opaque::duration;
+using histogram = opaque::hdr_histogram<duration>;
+
+struct cycles : opaque::numeric_typedef<std::uint32_t, cycles> {
+  using base = opaque::numeric_typedef<std::uint32_t, cycles>;
+  using base::base;
+};
+
+static_assert(histogram::bucket_count == 58 * 128);
+static_assert(std::is_same_v<decltype(histogram().percentile(50)), duration>);
+
+TEST(bucket_index) {
+  for (std::int64_t v = 0; v < 256; ++v) {
+    CHECK_EQUAL(std::size_t(v), histogram::bucket_of(duration(v)));
+  }
+  CHECK_EQUAL(256u, histogram::bucket_of(duration(256)));
+  CHECK_EQUAL(256u, histogram::bucket_of(duration(257)));
+  CHECK_EQUAL(257u, histogram::bucket_of(duration(258)));
+  CHECK_EQUAL(0u, histogram::bucket_of(duration(-5)));
+  CHECK_EQUAL(histogram::bucket_count - 1,
+      histogram::bucket_of(duration(INT64_MAX)) + 128);
+  std::size_t last = 0;
+  for (std::int64_t v = 1; v > 0 and v < INT64_MAX / 3; v = v * 3 / 2 + 1) {
+    const auto b = histogram::bucket_of(duration(v));
+    CHECK(b >= last);
+    CHECK(b < histogram::bucket_count);
+    last = b;
+  }
+}
+
+TEST(exact_small_values) {
+  histogram h;
+  for (std::int64_t v = 1; v <= 100; ++v) h.record(duration(v));
+  CHECK_EQUAL(100u, h.count());
+  CHECK_EQUAL(duration(1), h.min());
+  CHECK_EQUAL(duration(100), h.max());
+  CHECK_EQUAL(duration(50), h.percentile(50));
+  CHECK_EQUAL(duration(99), h.percentile(99));
+  CHECK_EQUAL(duration(100), h.percentile(100));
+  CHECK_EQUAL(duration(1), h.percentile(0));
+  CHECK(h.mean() >= 50.5 and h.mean() <= 50.5);
+}
+
+TEST(relative_error) {
+  histogram h;
+  std::mt19937_64 rng(1);
+  std::vector<std::int64_t> values;
+  for (int i = 0; i < 100000; ++i) {
+    values.push_back(static_cast<std::int64_t>(rng() % 10000000000));
+    h.record(duration(values.back()));
+  }
+  std::sort(values.begin(), values.end());
+  for (double p : { 10.0, 50.0, 90.0, 99.0, 99.9 }) {
+    const auto rank = static_cast<std::size_t>(p / 100 * 100000) - 1;
+    const double exact = static_cast<double>(values[rank]);
+    const double got = static_cast<double>(h.percentile(p).value);
+    CHECK(got >= exact);
+    CHECK(got <= exact * (1 + 1.0 / 128));
+  }
+}
+
+TEST(empty_and_reset) {
+  histogram h;
+  CHECK(h.empty());
+  CHECK_EQUAL(duration(0), h.percentile(99));
+  h.record(duration(12345), 3);
+  CHECK_EQUAL(3u, h.count());
+  h.reset();
+  CHECK(h.empty());
+}
+
+TEST(merge_per_thread) {
+  histogram total;
+  std::vector<histogram> local(4);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < local.size(); ++t) {
+    threads.emplace_back([&, t] {
+      for (std::int64_t i = 0; i < 10000; ++i) {
+        local[t].record_exclusive(duration(i * 1000));
+        total.record(duration(i));
+      }
+    });
+  }
+  for (auto& t : threads) t.join();
+  CHECK_EQUAL(40000u, total.count());
+  histogram merged;
+  for (const auto& h : local) merged.merge(h);
+  CHECK_EQUAL(40000u, merged.count());
+  CHECK(merged.percentile(50) >= duration(4999000));
+}
+
+TEST(narrow_unsigned) {
+  opaque::hdr_histogram<cycles, 4> h;
+  h.record(cycles(UINT32_MAX));
+  h.record(cycles(7u));
+  CHECK_EQUAL(cycles(7u), h.min());
+  CHECK_EQUAL(cycles(UINT32_MAX), h.max());
+}
@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/inconvertibool_bitvector.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <random>
+#include <vector>
+
+using opaque::inconvertibool;
+using opaque::inconvertibool_bitvector;
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 100000000);
+  std::mt19937_64 rng(11);
+  std::vector<inconvertibool> a(n), b(n);
+  inconvertibool_bitvector pa(n), pb(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto r = rng();
+    a[i] = pa[i] = inconvertibool((r & 1) != 0);
+    b[i] = pb[i] = inconvertibool((r & 6) != 0);
+  }
+  std::printf("bytes: vector %zu, bitvector %zu\n",
+      n * sizeof(inconvertibool), pa.words().size_bytes());
+
+  measure("vector<inconvertibool> and", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) a[i] &= b[i];
+    keep(a.data());
+  });
+  measure("bitvector and", n, [&] {
+    pa &= pb;
+    keep(pa.words().data());
+  });
+  measure("vector<inconvertibool> count", n, [&] {
+    std::size_t count = 0;
+    for (const auto& x : a) count += x.value;
+    keep(count);
+  });
+  measure("bitvector count", n, [&] {
+    keep(pa.count());
+  });
+  measure("bitvector iterate set", n, [&] {
+    std::size_t sum = 0;
+    pa.for_each_set([&](std::size_t i) { sum += i; });
+    keep(sum);
+  });
+}
@@ -0,0 +1,404 @@
+#ifndef OPAQUE_INCONVERTIBOOL_BITVECTOR_HPP
+#define OPAQUE_INCONVERTIBOOL_BITVECTOR_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/inconvertibool.hpp"
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Packed sequence of inconvertibool, one bit per element
+///
+/// This is the inconvertibool counterpart of std::vector<bool>: elements are
+/// packed into 64-bit words, and element access goes through a proxy that
+/// converts only to and from inconvertibool (and bool), never to integers.
+///
+/// Element i is bit (i % 64) of word (i / 64).  Bits of the last word beyond
+/// size() are always zero, so whole-vector operations work a word at a time
+/// without masking, in loops the compiler vectorizes.
+///
+/// The words are exposed for use as selection masks by bulk algorithms,
+/// which produce and consume them 64 elements at a time.
+///
+class inconvertibool_bitvector {
+public:
+  using value_type      = inconvertibool;
+  using size_type       = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using word_type       = std::uint64_t;
+  using const_reference = inconvertibool;
+
+  static constexpr size_type word_bits = 64;
+  static constexpr size_type npos = size_type(-1);
+
+  ///
+  /// Proxy for a single element
+  ///
+  class reference {
+    friend class inconvertibool_bitvector;
+    reference(word_type& w, word_type m) noexcept : word(&w), mask(m) { }
+    word_type * word;
+    word_type   mask;
+  public:
+    reference(const reference&) = default;
+
+    operator inconvertibool() const noexcept {
+      return inconvertibool((*word & mask) != 0);
+    }
+    inconvertibool operator~() const noexcept {
+      return inconvertibool((*word & mask) == 0);
+    }
+
+    reference& operator=(inconvertibool b) noexcept {
+      if (b.value) *word |= mask; else *word &= ~mask;
+      return *this;
+    }
+    reference& operator=(const reference& r) noexcept {
+      return *this = static_cast<inconvertibool>(r);
+    }
+
+    void flip() noexcept { *word ^= mask; }
+
+    friend bool operator==(const reference& a, const reference& b) noexcept {
+      return static_cast<inconvertibool>(a) == static_cast<inconvertibool>(b);
+    }
+  };
+
+  ///
+  /// Read-only iterator over the elements
+  ///
+  class const_iterator {
+    friend class inconvertibool_bitvector;
+    const_iterator(const word_type * w, size_type i) noexcept
+      : words(w), index(i) { }
+    const word_type * words = nullptr;
+    size_type         index = 0;
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = inconvertibool;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = void;
+    using reference         = inconvertibool;
+
+    const_iterator() = default;
+
+    reference operator*() const noexcept {
+      return inconvertibool(
+          ((words[index / word_bits] >> (index % word_bits)) & 1) != 0);
+    }
+    reference operator[](difference_type n) const noexcept {
+      return *(*this + n);
+    }
+
+    const_iterator& operator++() noexcept { ++index; return *this; }
+    const_iterator& operator--() noexcept { --index; return *this; }
+    const_iterator operator++(int) noexcept {
+      const_iterator r(*this); ++index; return r; }
+    const_iterator operator--(int) noexcept {
+      const_iterator r(*this); --index; return r; }
+
+    const_iterator& operator+=(difference_type n) noexcept {
+      index = static_cast<size_type>(static_cast<difference_type>(index) + n);
+      return *this;
+    }
+    const_iterator& operator-=(difference_type n) noexcept {
+      return *this += -n;
+    }
+    friend const_iterator operator+(const_iterator i, difference_type n)
+      noexcept { return i += n; }
+    friend const_iterator operator+(difference_type n, const_iterator i)
+      noexcept { return i += n; }
+    friend const_iterator operator-(const_iterator i, difference_type n)
+      noexcept { return i -= n; }
+    friend difference_type operator-(const const_iterator& a,
+        const const_iterator& b) noexcept {
+      return static_cast<difference_type>(a.index) -
+             static_cast<difference_type>(b.index);
+    }
+
+    friend bool operator==(const const_iterator& a, const const_iterator& b)
+      noexcept { return a.index == b.index; }
+    friend auto operator<=>(const const_iterator& a, const const_iterator& b)
+      noexcept { return a.index <=> b.index; }
+  };
+
+  using iterator = const_iterator;
+
+  inconvertibool_bitvector() = default;
+
+  explicit inconvertibool_bitvector(size_type n,
+      inconvertibool initial = false)
+    : words_(words_for(n), initial.value ? ~word_type{0} : word_type{0})
+    , size_(n) { trim(); }
+
+  inconvertibool_bitvector(std::initializer_list<inconvertibool> il) {
+    reserve(il.size());
+    for (const auto& b : il) push_back(b);
+  }
+
+  ///
+  /// Adopt packed words as a bit vector of n elements
+  ///
+  /// Bits of the words beyond n are ignored.
+  ///
+  static inconvertibool_bitvector from_words(std::vector<word_type> words,
+      size_type n) {
+    if (words.size() < words_for(n)) {
+      throw std::invalid_argument(
+          "opaque::inconvertibool_bitvector::from_words");
+    }
+    inconvertibool_bitvector r;
+    words.resize(words_for(n));
+    r.words_ = std::move(words);
+    r.size_ = n;
+    r.trim();
+    return r;
+  }
+
+  size_type size()     const noexcept { return size_; }
+  bool      empty()    const noexcept { return size_ == 0; }
+  size_type capacity() const noexcept { return words_.capacity() * word_bits; }
+
+  /// The packed words, least significant bit first
+  std::span<const word_type> words() const noexcept { return words_; }
+
+  void reserve(size_type n) { words_.reserve(words_for(n)); }
+
+  void resize(size_type n, inconvertibool fill = false) {
+    if (n > size_ and fill.value) {
+      if (size_ % word_bits) words_.back() |= ~word_type{0} << (size_ % word_bits);
+      words_.resize(words_for(n), ~word_type{0});
+    } else {
+      words_.resize(words_for(n), 0);
+    }
+    size_ = n;
+    trim();
+  }
+
+  void clear() noexcept { words_.clear(); size_ = 0; }
+
+  void push_back(inconvertibool b) {
+    if (size_ % word_bits == 0) words_.push_back(0);
+    words_.back() |= word_type{b.value} << (size_ % word_bits);
+    ++size_;
+  }
+
+  void pop_back() noexcept {
+    --size_;
+    trim();
+    if (size_ % word_bits == 0) words_.pop_back();
+  }
+
+  reference operator[](size_type i) noexcept {
+    return reference(words_[i / word_bits], bit(i));
+  }
+  const_reference operator[](size_type i) const noexcept {
+    return inconvertibool((words_[i / word_bits] & bit(i)) != 0);
+  }
+
+  reference at(size_type i) {
+    check(i);
+    return (*this)[i];
+  }
+  const_reference at(size_type i) const {
+    check(i);
+    return (*this)[i];
+  }
+
+  reference front() noexcept { return (*this)[0]; }
+  reference back()  noexcept { return (*this)[size_ - 1]; }
+  const_reference front() const noexcept { return (*this)[0]; }
+  const_reference back()  const noexcept { return (*this)[size_ - 1]; }
+
+  const_iterator begin()  const noexcept { return { words_.data(), 0 }; }
+  const_iterator end()    const noexcept { return { words_.data(), size_ }; }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend()   const noexcept { return end(); }
+
+  //
+  // Whole-vector operations
+  //
+  // The binary operations require operands of equal size, and throw
+  // std::invalid_argument otherwise.
+  //
+
+  inconvertibool_bitvector& operator&=(const inconvertibool_bitvector& o) {
+    same_size(o);
+    for (size_type i = 0; i < words_.size(); ++i) words_[i] &= o.words_[i];
+    return *this;
+  }
+  inconvertibool_bitvector& operator|=(const inconvertibool_bitvector& o) {
+    same_size(o);
+    for (size_type i = 0; i < words_.size(); ++i) words_[i] |= o.words_[i];
+    return *this;
+  }
+  inconvertibool_bitvector& operator^=(const inconvertibool_bitvector& o) {
+    same_size(o);
+    for (size_type i = 0; i < words_.size(); ++i) words_[i] ^= o.words_[i];
+    return *this;
+  }
+
+  /// Clear every element that is set in o
+  inconvertibool_bitvector& and_not(const inconvertibool_bitvector& o) {
+    same_size(o);
+    for (size_type i = 0; i < words_.size(); ++i) words_[i] &= ~o.words_[i];
+    return *this;
+  }
+
+  /// Invert every element
+  inconvertibool_bitvector& flip() noexcept {
+    for (auto& w : words_) w = ~w;
+    trim();
+    return *this;
+  }
+
+  friend inconvertibool_bitvector operator&(inconvertibool_bitvector a,
+      const inconvertibool_bitvector& b) { return a &= b; }
+  friend inconvertibool_bitvector operator|(inconvertibool_bitvector a,
+      const inconvertibool_bitvector& b) { return a |= b; }
+  friend inconvertibool_bitvector operator^(inconvertibool_bitvector a,
+      const inconvertibool_bitvector& b) { return a ^= b; }
+  friend inconvertibool_bitvector operator~(inconvertibool_bitvector a)
+    noexcept { return std::move(a.flip()); }
+
+  /// Number of elements that are set
+  size_type count() const noexcept {
+    size_type n = 0;
+    for (const auto w : words_) n += static_cast<size_type>(std::popcount(w));
+    return n;
+  }
+
+  bool any() const noexcept {
+    for (const auto w : words_) if (w) return true;
+    return false;
+  }
+  bool none() const noexcept { return not any(); }
+  bool all()  const noexcept { return count() == size_; }
+
+  /// Index of the first set element, or npos
+  size_type find_first() const noexcept { return scan(0); }
+
+  /// Index of the first set element after pos, or npos
+  size_type find_next(size_type pos) const noexcept {
+    if (++pos >= size_) return npos;
+    const size_type w = pos / word_bits;
+    const word_type rest = words_[w] & (~word_type{0} << (pos % word_bits));
+    if (rest) return w * word_bits + static_cast<size_type>(std::countr_zero(rest));
+    return scan(w + 1);
+  }
+
+  /// Call f with the index of each set element, in increasing order
+  template <typename F>
+  void for_each_set(F&& f) const {
+    for (size_type w = 0; w < words_.size(); ++w) {
+      for (word_type m = words_[w]; m; m &= m - 1) {
+        f(w * word_bits + static_cast<size_type>(std::countr_zero(m)));
+      }
+    }
+  }
+
+  void swap(inconvertibool_bitvector& o) noexcept {
+    words_.swap(o.words_);
+    std::swap(size_, o.size_);
+  }
+
+  friend bool operator==(const inconvertibool_bitvector& a,
+      const inconvertibool_bitvector& b) noexcept {
+    return a.size_ == b.size_ and a.words_ == b.words_;
+  }
+
+private:
+  static constexpr size_type words_for(size_type n) noexcept {
+    return (n + word_bits - 1) / word_bits;
+  }
+  static constexpr word_type bit(size_type i) noexcept {
+    return word_type{1} << (i % word_bits);
+  }
+
+  void trim() noexcept {
+    if (size_ % word_bits) words_.back() &= ~(~word_type{0} << (size_ % word_bits));
+  }
+
+  void check(size_type i) const {
+    if (i >= size_) throw std::out_of_range("opaque::inconvertibool_bitvector::at");
+  }
+
+  void same_size(const inconvertibool_bitvector& o) const {
+    if (o.size_ != size_) {
+      throw std::invalid_argument("opaque::inconvertibool_bitvector size mismatch");
+    }
+  }
+
+  size_type scan(size_type w) const noexcept {
+    for (; w < words_.size(); ++w) {
+      if (words_[w]) {
+        return w * word_bits + static_cast<size_type>(std::countr_zero(words_[w]));
+      }
+    }
+    return npos;
+  }
+
+  std::vector<word_type> words_;
+  size_type size_ = 0;
+};
+
+inline void swap(inconvertibool_bitvector& a, inconvertibool_bitvector& b)
+  noexcept { a.swap(b); }
+
+///
+/// Copy the elements of a span that are selected by a mask
+///
+/// The mask must have the same size as the span.
+///
+template <typename T, typename OutputIt>
+OutputIt copy_selected(std::span<T> in,
+    const inconvertibool_bitvector& mask, OutputIt out) {
+  if (mask.size() != in.size()) {
+    throw std::invalid_argument("opaque::copy_selected size mismatch");
+  }
+  mask.for_each_set([&](std::size_t i) { *out++ = in[i]; });
+  return out;
+}
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/inconvertibool_bitvector.hpp"
+#include "opaque/flags_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+using opaque::inconvertibool;
+using opaque::inconvertibool_bitvector;
+
+static_assert(not std::is_convertible_v<inconvertibool_bitvector::reference, int>);
+static_assert(std::is_convertible_v<inconvertibool_bitvector::reference,
+                                    inconvertibool>);
+static_assert(std::random_access_iterator<inconvertibool_bitvector::const_iterator>);
+
+TEST(elements) {
+  inconvertibool_bitvector v;
+  CHECK(v.empty());
+  for (unsigned i = 0; i < 130; ++i) v.push_back(i % 3 == 0);
+  CHECK_EQUAL(130u, v.size());
+  CHECK_EQUAL(44u, v.count());
+  CHECK(v[0] == true);
+  CHECK(v[1] == false);
+  v[1] = true;
+  v[0].flip();
+  CHECK(v[1] == true);
+  CHECK(v[0] == false);
+  v[2] = v[1];
+  CHECK(v[2] == true);
+  v.pop_back();
+  CHECK_EQUAL(129u, v.size());
+  CHECK(v.back() == false);
+  std::size_t n = 0;
+  for (inconvertibool b : v) n += b.value;
+  CHECK_EQUAL(v.count(), n);
+  try {
+    v.at(129);
+    CHECK_CATCH(std::out_of_range, e);
+  }
+}
+
+TEST(resize) {
+  inconvertibool_bitvector v(70, true);
+  CHECK(v.all());
+  CHECK_EQUAL(70u, v.count());
+  v.resize(10);
+  v.resize(100);
+  CHECK_EQUAL(10u, v.count());
+  v.resize(200, true);
+  CHECK_EQUAL(110u, v.count());
+  CHECK(v[99] == false);
+  CHECK(v[100] == true);
+}
+
+TEST(algebra) {
+  inconvertibool_bitvector a(200), b(200);
+  for (std::size_t i = 0; i < 200; ++i) {
+    a[i] = i % 2 == 0;
+    b[i] = i % 3 == 0;
+  }
+  CHECK_EQUAL(34u, (a & b).count());
+  CHECK_EQUAL(133u, (a | b).count());
+  CHECK_EQUAL(99u, (a ^ b).count());
+  CHECK_EQUAL(100u, (~a).count());
+  CHECK_EQUAL(66u, inconvertibool_bitvector(a).and_not(b).count());
+  CHECK(~~a == a);
+  try {
+    a &= inconvertibool_bitvector(199);
+    CHECK_CATCH(std::invalid_argument, e);
+  }
+}
+
+TEST(find) {
+  inconvertibool_bitvector v(300);
+  CHECK_EQUAL(inconvertibool_bitvector::npos, v.find_first());
+  const std::size_t set[] = { 5, 63, 64, 200, 299 };
+  for (auto i : set) v[i] = true;
+  std::vector<std::size_t> found;
+  for (auto i = v.find_first(); i != v.npos; i = v.find_next(i)) {
+    found.push_back(i);
+  }
+  CHECK(found == std::vector<std::size_t>(std::begin(set), std::end(set)));
+  found.clear();
+  v.for_each_set([&](std::size_t i) { found.push_back(i); });
+  CHECK_EQUAL(5u, found.size());
+}
+
+enum class perm : std::uint8_t { read = 1, write = 2 };
+
+struct perms : opaque::flags_typedef<perm, perms> {
+  using base = opaque::flags_typedef<perm, perms>;
+  using base::base;
+};
+
+TEST(selection) {
+  std::vector<perms> users;
+  std::vector<int> ids;
+  for (int i = 0; i < 150; ++i) {
+    users.push_back(perms::from_bits(static_cast<std::uint8_t>(i % 4)));
+    ids.push_back(i);
+  }
+  const auto writers = opaque::select_with_bits(std::span(users),
+      perms(perm::write));
+  CHECK_EQUAL(150u, writers.size());
+  CHECK_EQUAL(opaque::count_with_bits(std::span(users), perms(perm::write)),
+      writers.count());
+  std::vector<int> selected;
+  opaque::copy_selected(std::span(ids), writers, std::back_inserter(selected));
+  CHECK_EQUAL(writers.count(), selected.size());
+  for (int id : selected) {
+    CHECK(users[static_cast<std::size_t>(id)].test(perm::write));
+  }
+}
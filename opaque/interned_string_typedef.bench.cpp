@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/interned_string_typedef.hpp"
+#include "opaque/safer_string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+struct symbol_name
+  : opaque::experimental::safer_string_typedef<std::string, symbol_name> {
+  using base =
+    opaque::experimental::safer_string_typedef<std::string, symbol_name>;
+  using base::base;
+};
+
+struct symbol : opaque::experimental::interned_string_typedef<symbol> {
+  using base = opaque::experimental::interned_string_typedef<symbol>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(symbol_name, opaque::hash_policy::seeded<>)
+OPAQUE_HASHABLE(symbol)
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 10000000);
+  constexpr std::size_t distinct = 4096;
+
+  std::vector<std::string> text;
+  for (std::size_t i = 0; i < distinct; ++i) {
+    text.push_back("service.request.handler." + std::to_string(i * 7919));
+  }
+  std::vector<symbol_name> names(text.begin(), text.end());
+  std::vector<symbol> symbols;
+  measure("interned_string_typedef construct, new", distinct, [&] {
+    for (const auto& t : text) symbols.emplace_back(t);
+  });
+  measure("interned_string_typedef construct, existing", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      keep(symbol(text[i % distinct]));
+    }
+  });
+  measure("safer_string_typedef construct", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      keep(symbol_name(text[i % distinct]));
+    }
+  });
+
+  // Compare neighbours; equal strings share a long prefix, the worst case
+  measure("safer_string_typedef ==", n, [&] {
+    std::size_t eq = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      eq += names[i % distinct] == names[(i * 3) % distinct];
+    }
+    keep(eq);
+  });
+  measure("interned_string_typedef ==", n, [&] {
+    std::size_t eq = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      eq += symbols[i % distinct] == symbols[(i * 3) % distinct];
+    }
+    keep(eq);
+  });
+  measure("safer_string_typedef hash", n, [&] {
+    std::size_t h = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      h ^= std::hash<symbol_name>{}(names[i % distinct]);
+    }
+    keep(h);
+  });
+  measure("interned_string_typedef hash", n, [&] {
+    std::size_t h = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      h ^= std::hash<symbol>{}(symbols[i % distinct]);
+    }
+    keep(h);
+  });
+  measure("interned_string_typedef view", n, [&] {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < n; ++i) total += symbols[i % distinct].size();
+    keep(total);
+  });
+}
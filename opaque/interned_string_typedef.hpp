@@ -0,0 +1,360 @@
+#ifndef OPAQUE_INTERNED_STRING_TYPEDEF_HPP
+#define OPAQUE_INTERNED_STRING_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/storage.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/safer_string_typedef.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+///
+/// Concurrent append-only table of strings, each named by a 32-bit id
+///
+/// Text is copied into arenas that never move, and the id -> text map is a
+/// series of doubling segments that never move either, so text(id) is two
+/// dependent loads with no lock.
+///
+/// The text -> id map is split into shards by hash.  Each shard is an open
+/// addressing table of atomic words (32 bits of hash, id + 1) which readers
+/// probe without locking; writers lock only their shard.  When a shard
+/// grows, the old probe table stays allocated for readers still using it.
+///
+template <typename CharT, typename Traits>
+class intern_table {
+public:
+  using view_type = std::basic_string_view<CharT, Traits>;
+
+  /// Id 0 always holds the empty string
+  intern_table() { intern(view_type()); }
+
+  intern_table(const intern_table&) = delete;
+  intern_table& operator=(const intern_table&) = delete;
+
+  ~intern_table() {
+    for (auto& s : segments_) delete[] s.load(std::memory_order_relaxed);
+  }
+
+  /// The text of an id previously returned by intern()
+  view_type text(std::uint32_t id) const noexcept {
+    const entry& e = entry_of(id);
+    return view_type(e.data, e.size);
+  }
+
+  /// The id of s, if it has been interned
+  std::optional<std::uint32_t> find(view_type s) const noexcept {
+    const std::uint64_t h = hash(s);
+    return lookup(shards_[shard_of(h)].table.load(std::memory_order_acquire),
+        s, h);
+  }
+
+  /// The id of s, interning a copy of it if necessary
+  std::uint32_t intern(view_type s) {
+    const std::uint64_t h = hash(s);
+    shard& sh = shards_[shard_of(h)];
+    if (auto id = lookup(sh.table.load(std::memory_order_acquire), s, h)) {
+      return *id;
+    }
+    std::lock_guard<std::mutex> guard(sh.lock);
+    const probe_table * t = sh.table.load(std::memory_order_relaxed);
+    if (auto id = lookup(t, s, h)) return *id;
+    if (2 * (sh.used + 1) > t->mask + 1) t = grow(sh);
+
+    const std::uint32_t id = next_.fetch_add(1, std::memory_order_relaxed);
+    if (id == UINT32_MAX) {
+      throw std::length_error("opaque::intern_table is full");
+    }
+    entry& e = make_entry(id);
+    e.data = copy_text(sh, s);
+    e.size = s.size();
+    // Publishing the slot makes the entry visible to readers that find it
+    std::size_t i = h & t->mask;
+    while (t->slot[i].load(std::memory_order_relaxed)) i = (i + 1) & t->mask;
+    t->slot[i].store(word_of(h, id), std::memory_order_release);
+    ++sh.used;
+    return id;
+  }
+
+  /// Number of distinct strings interned
+  std::uint32_t size() const noexcept {
+    return next_.load(std::memory_order_relaxed);
+  }
+
+private:
+  struct entry {
+    const CharT * data;
+    std::size_t   size;
+  };
+
+  struct probe_table {
+    explicit probe_table(std::size_t n)
+      : mask(n - 1), slot(std::make_unique<std::atomic<std::uint64_t>[]>(n)) { }
+    std::size_t mask;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> slot;
+  };
+
+  struct shard {
+    shard() : table(nullptr) {
+      tables.push_back(std::make_unique<probe_table>(initial_slots));
+      table.store(tables.back().get(), std::memory_order_relaxed);
+    }
+    std::mutex lock;
+    std::atomic<const probe_table *> table;
+    std::vector<std::unique_ptr<probe_table>> tables;
+    std::size_t used = 0;
+    std::vector<std::unique_ptr<CharT[]>> chunks;
+    CharT * free = nullptr;
+    std::size_t free_size = 0;
+  };
+
+  static constexpr unsigned    shard_bits    = 4;
+  static constexpr std::size_t initial_slots = 64;
+  static constexpr std::size_t chunk_chars   = 16384;
+  static constexpr unsigned    first_bits    = 10;
+  static constexpr unsigned    segment_count = 33 - first_bits;
+
+  static std::uint64_t hash(view_type s) noexcept {
+    return hash_policy::seeded<>{}(s);
+  }
+
+  static std::size_t shard_of(std::uint64_t h) noexcept {
+    return static_cast<std::size_t>(h >> (64 - shard_bits));
+  }
+
+  static std::uint64_t word_of(std::uint64_t h, std::uint32_t id) noexcept {
+    return (h & 0xffffffff00000000u) | (std::uint64_t{id} + 1);
+  }
+
+  std::optional<std::uint32_t> lookup(const probe_table * t, view_type s,
+      std::uint64_t h) const noexcept {
+    for (std::size_t i = h & t->mask; ; i = (i + 1) & t->mask) {
+      const std::uint64_t w = t->slot[i].load(std::memory_order_acquire);
+      if (w == 0) return std::nullopt;
+      if ((w ^ h) >> 32 == 0) {
+        const auto id = static_cast<std::uint32_t>(w - 1);
+        if (text(id) == s) return id;
+      }
+    }
+  }
+
+  const probe_table * grow(shard& sh) {
+    const probe_table * old = sh.table.load(std::memory_order_relaxed);
+    auto fresh = std::make_unique<probe_table>(2 * (old->mask + 1));
+    for (std::size_t j = 0; j <= old->mask; ++j) {
+      const std::uint64_t w = old->slot[j].load(std::memory_order_relaxed);
+      if (w == 0) continue;
+      const std::uint64_t h = hash(text(static_cast<std::uint32_t>(w - 1)));
+      std::size_t i = h & fresh->mask;
+      while (fresh->slot[i].load(std::memory_order_relaxed)) {
+        i = (i + 1) & fresh->mask;
+      }
+      fresh->slot[i].store(w, std::memory_order_relaxed);
+    }
+    sh.tables.push_back(std::move(fresh));
+    sh.table.store(sh.tables.back().get(), std::memory_order_release);
+    return sh.tables.back().get();
+  }
+
+  static const CharT * copy_text(shard& sh, view_type s) {
+    const std::size_t n = s.size() + 1;
+    if (n > sh.free_size) {
+      const std::size_t size = std::max(n, chunk_chars);
+      sh.chunks.push_back(std::make_unique<CharT[]>(size));
+      sh.free = sh.chunks.back().get();
+      sh.free_size = size;
+    }
+    CharT * p = sh.free;
+    Traits::copy(p, s.data(), s.size());
+    Traits::assign(p[s.size()], CharT());
+    sh.free += n;
+    sh.free_size -= n;
+    return p;
+  }
+
+  // Segment k holds ids [2^b (2^k - 1), 2^b (2^(k+1) - 1)) for b = first_bits
+  static unsigned segment_of(std::uint64_t biased) noexcept {
+    return static_cast<unsigned>(std::bit_width(biased)) - (first_bits + 1);
+  }
+
+  const entry& entry_of(std::uint32_t id) const noexcept {
+    const std::uint64_t biased = std::uint64_t{id} + (1u << first_bits);
+    const unsigned k = segment_of(biased);
+    const entry * seg = segments_[k].load(std::memory_order_acquire);
+    return seg[biased - (std::uint64_t{1} << (first_bits + k))];
+  }
+
+  entry& make_entry(std::uint32_t id) {
+    const std::uint64_t biased = std::uint64_t{id} + (1u << first_bits);
+    const unsigned k = segment_of(biased);
+    entry * seg = segments_[k].load(std::memory_order_acquire);
+    if (not seg) {
+      auto * fresh = new entry[std::size_t{1} << (first_bits + k)]();
+      if (segments_[k].compare_exchange_strong(seg, fresh,
+            std::memory_order_acq_rel)) {
+        seg = fresh;
+      } else {
+        delete[] fresh;
+      }
+    }
+    return seg[biased - (std::uint64_t{1} << (first_bits + k))];
+  }
+
+  std::atomic<std::uint32_t> next_{0};
+  std::atomic<entry *>       segments_[segment_count] = {};
+  shard                      shards_[std::size_t{1} << shard_bits];
+};
+
+}
+
+/// @}
+
+namespace experimental {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// String typedef stored as a 32-bit handle into an intern table
+///
+/// Suited to strings that take few distinct values but are compared and
+/// hashed often, such as symbol names and tag keys.  Equal strings of the
+/// same O always have the same handle, so equality and OPAQUE_HASHABLE
+/// hashing compare or hash one integer, and the text is reached in O(1)
+/// through view().  Note that <=> orders by handle, which is the order of
+/// first interning, not lexicographic order.
+///
+/// Each O has its own table, shared by all threads.  Constructing from text
+/// looks the text up without a lock and locks one of sixteen shards only to
+/// insert new text.  Tables are never freed, so instances remain valid
+/// during static destruction.
+///
+/// Conversion from and to safer_string_typedef instances is explicit and
+/// copies the text.
+///
+/// Template arguments:
+///  -# O : The result type, your subclass
+///  -# CharT : The character type
+///  -# Traits : The character traits type
+///
+template <typename O, typename CharT = char,
+         typename Traits = std::char_traits<CharT>>
+struct interned_string_typedef : opaque_storage<std::uint32_t, O> {
+private:
+  using base = opaque_storage<std::uint32_t, O>;
+  using table_type = detail::intern_table<CharT, Traits>;
+public:
+  using underlying_type = std::uint32_t;
+  using     opaque_type = O;
+  using base::value;
+
+  using traits_type    = Traits;
+  using value_type     = CharT;
+  using size_type      = std::size_t;
+  using view_type      = std::basic_string_view<CharT, Traits>;
+  using const_iterator = typename view_type::const_iterator;
+
+  /// The empty string
+  constexpr interned_string_typedef() noexcept : base(0u) { }
+
+  explicit interned_string_typedef(view_type s)
+    : base(table().intern(s)) { }
+
+  explicit interned_string_typedef(const CharT * s)
+    : interned_string_typedef(view_type(s)) { }
+
+  template <typename S, typename R>
+    requires std::same_as<typename S::value_type, CharT>
+  explicit interned_string_typedef(const safer_string_typedef<S,R>& s)
+    : interned_string_typedef(view_type(s.value.data(), s.value.size())) { }
+
+  /// Copy the text into a safer_string_typedef
+  template <typename R>
+    requires std::derived_from<R,
+      safer_string_typedef<typename R::underlying_type, R>>
+  explicit operator R() const {
+    return R(typename R::underlying_type(view()));
+  }
+
+  /// The instance for s, if s has been interned
+  static std::optional<opaque_type> find(view_type s) noexcept {
+    const auto id = table().find(s);
+    if (not id) return std::nullopt;
+    opaque_type r;
+    r.value = *id;
+    return r;
+  }
+
+  /// Number of distinct strings interned for O, including the empty string
+  static std::uint32_t interned_count() noexcept { return table().size(); }
+
+  /// The handle; stable only within one process
+  constexpr std::uint32_t id() const noexcept { return value; }
+
+  view_type view() const noexcept { return table().text(value); }
+
+  /// The text, which is null-terminated
+  const CharT * c_str() const noexcept { return view().data(); }
+  const CharT *  data() const noexcept { return view().data(); }
+  size_type      size() const noexcept { return view().size(); }
+  bool          empty() const noexcept { return value == 0; }
+
+  const_iterator begin() const noexcept { return view().begin(); }
+  const_iterator   end() const noexcept { return view().end();   }
+
+private:
+  static table_type& table() {
+    static table_type * t = new table_type;
+    return *t;
+  }
+};
+
+/// @}
+
+}
+}
+
+#endif
@@ -0,0 +1,140 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/interned_string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "arrtest/arrtest.hpp"
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+struct symbol : opaque::experimental::interned_string_typedef<symbol> {
+  using base = opaque::experimental::interned_string_typedef<symbol>;
+  using base::base;
+};
+
+struct tag_key : opaque::experimental::interned_string_typedef<tag_key> {
+  using base = opaque::experimental::interned_string_typedef<tag_key>;
+  using base::base;
+};
+
+struct symbol_name
+  : opaque::experimental::safer_string_typedef<std::string, symbol_name> {
+  using base =
+    opaque::experimental::safer_string_typedef<std::string, symbol_name>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(symbol)
+
+static_assert(sizeof(symbol) == 4);
+static_assert(not std::is_convertible_v<const char *, symbol>);
+static_assert(not std::is_convertible_v<std::string, symbol>);
+static_assert(not std::is_convertible_v<symbol_name, symbol>);
+static_assert(not std::is_convertible_v<symbol, symbol_name>);
+static_assert(not std::is_constructible_v<symbol, tag_key>);
+static_assert(std::is_constructible_v<symbol, symbol_name>);
+static_assert(std::is_constructible_v<symbol_name, symbol>);
+
+TEST(identity) {
+  const symbol a("alpha"), b(std::string("alpha")), c("beta");
+  CHECK(a == b);
+  CHECK(a != c);
+  CHECK_EQUAL(a.id(), b.id());
+  CHECK(a.view() == "alpha");
+  CHECK_EQUAL(5u, a.size());
+  CHECK_EQUAL('\0', a.c_str()[5]);
+  CHECK_EQUAL(std::hash<symbol>{}(a), std::hash<symbol>{}(b));
+  CHECK(std::string(c.begin(), c.end()) == "beta");
+}
+
+TEST(empty) {
+  const symbol e, f("");
+  CHECK(e.empty());
+  CHECK(e == f);
+  CHECK_EQUAL(0u, e.size());
+  CHECK_EQUAL(0u, e.id());
+}
+
+TEST(separate_tables) {
+  const symbol s("gamma");
+  CHECK(not tag_key::find("gamma"));
+  CHECK(symbol::find("gamma") == s);
+  CHECK(not symbol::find("never interned"));
+}
+
+TEST(safer_string_conversion) {
+  const symbol_name n("delta");
+  const symbol s(n);
+  CHECK(s.view() == "delta");
+  const auto back = static_cast<symbol_name>(s);
+  CHECK(back == n);
+}
+
+TEST(many_strings) {
+  std::vector<symbol> v;
+  for (int i = 0; i < 50000; ++i) v.emplace_back(std::to_string(i));
+  for (int i = 0; i < 50000; ++i) {
+    CHECK(v[std::size_t(i)].view() == std::to_string(i));
+    CHECK(symbol(std::to_string(i)) == v[std::size_t(i)]);
+  }
+  std::unordered_set<symbol> distinct(v.begin(), v.end());
+  CHECK_EQUAL(50000u, distinct.size());
+}
+
+TEST(concurrent_interning) {
+  constexpr int threads = 4, strings = 20000;
+  std::vector<std::vector<tag_key>> seen(threads);
+  std::vector<std::thread> pool;
+  for (int t = 0; t < threads; ++t) {
+    pool.emplace_back([&, t] {
+      for (int i = 0; i < strings; ++i) {
+        // Every thread interns the same strings, in different orders
+        const int k = (i * (2 * t + 1)) % strings;
+        seen[std::size_t(t)].emplace_back("key" + std::to_string(k));
+      }
+    });
+  }
+  for (auto& p : pool) p.join();
+  CHECK_EQUAL(std::uint32_t(strings + 1), tag_key::interned_count());
+  for (int i = 0; i < strings; ++i) {
+    const tag_key k("key" + std::to_string(i));
+    CHECK(k.view() == "key" + std::to_string(i));
+  }
+  for (int t = 0; t < threads; ++t) {
+    for (int i = 0; i < strings; ++i) {
+      const int k = (i * (2 * t + 1)) % strings;
+      CHECK(seen[std::size_t(t)][std::size_t(i)] ==
+            tag_key("key" + std::to_string(k)));
+    }
+  }
+}
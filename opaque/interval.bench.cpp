@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/interval.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+struct bases : opaque::numeric_typedef<std::int32_t, bases> {
+  using base = opaque::numeric_typedef<std::int32_t, bases>;
+  using base::base;
+};
+
+struct locus : opaque::position_typedef<bases, locus> {
+  using base = opaque::position_typedef<bases, locus>;
+  using base::base;
+};
+
+using span_t = opaque::interval<locus>;
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 20000000);
+  std::mt19937 rng(3);
+  std::vector<span_t> v;
+  v.reserve(n);
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto s = static_cast<std::int32_t>(rng() % 100000000);
+    v.emplace_back(locus(s), bases(static_cast<std::int32_t>(rng() % 5000)));
+  }
+  const span_t q(locus(50000000), locus(50100000));
+
+  measure("overlap scalar loop", n, [&] {
+    std::vector<std::size_t> hits;
+    for (std::size_t i = 0; i < n; ++i) {
+      if (v[i].overlaps(q)) hits.push_back(i);
+    }
+    keep(hits.size());
+  });
+  measure("overlaps mask", n, [&] {
+    keep(opaque::overlaps(std::span(v), q).count());
+  });
+  measure("count_overlaps", n, [&] {
+    keep(opaque::count_overlaps(std::span(v), q));
+  });
+  measure("contains mask", n, [&] {
+    keep(opaque::overlaps(std::span(v), locus(123456)).count());
+  });
+  std::vector<span_t> out(n);
+  measure("clip", n, [&] {
+    opaque::clip(std::span(v), q, std::span(out));
+    keep(out.data());
+  });
+}
@@ -0,0 +1,212 @@
+#ifndef OPAQUE_INTERVAL_HPP
+#define OPAQUE_INTERVAL_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/position_typedef.hpp"
+#include "opaque/inconvertibool_bitvector.hpp"
+#include "opaque/simd.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opaque {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Half-open interval [start, end) of positions
+///
+/// The length is the Distance type of the position_typedef, so lengths and
+/// positions cannot be confused.  An interval with end <= start is empty.
+///
+/// Template arguments:
+///  -# Position : A position_typedef
+///
+template <typename Position>
+struct interval {
+  using position_type = Position;
+  using distance_type = typename Position::distance_type;
+
+  Position start;
+  Position end;
+
+  constexpr interval() noexcept : start(), end() { }
+  constexpr interval(const Position& s, const Position& e) noexcept
+    : start(s), end(e) { }
+  constexpr interval(const Position& s, const distance_type& length) noexcept
+    : start(s), end(s + length) { }
+
+  constexpr bool empty() const noexcept { return not (start < end); }
+
+  /// Distance from start to end, or zero if empty
+  constexpr distance_type length() const noexcept {
+    return empty() ? distance_type() : end - start;
+  }
+
+  constexpr bool contains(const Position& p) const noexcept {
+    return start <= p and p < end;
+  }
+
+  /// Whether the intervals share at least one position
+  constexpr bool overlaps(const interval& o) const noexcept {
+    return start < o.end and o.start < end and not empty() and not o.empty();
+  }
+
+  /// The part of this interval inside the window, empty if none
+  constexpr interval clip(const interval& window) const noexcept {
+    const Position s = start < window.start ? window.start : start;
+    const Position e = window.end < end ? window.end : end;
+    return { s, e < s ? s : e };
+  }
+
+  friend constexpr bool operator==(const interval&, const interval&) = default;
+};
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+///
+/// Evaluate a predicate for each index below n into a selection mask
+///
+/// The predicate is evaluated 64 indices at a time into bytes, in a loop
+/// free of branches that the compiler vectorizes, and the bytes are packed
+/// into mask words.
+///
+template <typename Pred>
+inconvertibool_bitvector select_indices(std::size_t n, Pred pred) {
+  std::vector<std::uint64_t> words;
+  words.reserve((n + 63) / 64);
+  alignas(16) std::uint8_t flags[64];
+  for (std::size_t i = 0; i < n; i += 64) {
+    const std::size_t block = n - i < 64 ? n - i : 64;
+    for (std::size_t j = 0; j < block; ++j) {
+      flags[j] = static_cast<std::uint8_t>(pred(i + j));
+    }
+    for (std::size_t j = block; j < 64; ++j) flags[j] = 0;
+    words.push_back(pack_flags_64(flags));
+  }
+  return inconvertibool_bitvector::from_words(std::move(words), n);
+}
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+//
+// Bulk interval queries
+//
+// These compare the underlying values of the positions directly, without
+// branches, so a scan runs at vector speed; results are selection masks.
+//
+
+/// Select the intervals containing a position
+template <typename Position>
+inconvertibool_bitvector overlaps(
+    std::span<const interval<std::type_identity_t<Position>>> intervals,
+    const Position& p) {
+  const auto x = p.value;
+  return detail::select_indices(intervals.size(), [&](std::size_t i) {
+    return (intervals[i].start.value <= x) & (x < intervals[i].end.value);
+  });
+}
+
+/// Select the intervals sharing at least one position with a query interval
+template <typename Position>
+inconvertibool_bitvector overlaps(
+    std::span<const interval<std::type_identity_t<Position>>> intervals,
+    const interval<Position>& q) {
+  if (q.empty()) return inconvertibool_bitvector(intervals.size());
+  const auto s = q.start.value;
+  const auto e = q.end.value;
+  return detail::select_indices(intervals.size(), [&](std::size_t i) {
+    const auto is = intervals[i].start.value;
+    const auto ie = intervals[i].end.value;
+    return (is < e) & (s < ie) & (is < ie);
+  });
+}
+
+/// Count the intervals sharing at least one position with a query interval
+template <typename Position>
+std::size_t count_overlaps(
+    std::span<const interval<std::type_identity_t<Position>>> intervals,
+    const interval<Position>& q) {
+  if (q.empty()) return 0;
+  const auto s = q.start.value;
+  const auto e = q.end.value;
+  std::size_t n = 0;
+  for (const auto& iv : intervals) {
+    n += static_cast<std::size_t>((iv.start.value < e) &
+        (s < iv.end.value) & (iv.start.value < iv.end.value));
+  }
+  return n;
+}
+
+///
+/// Clip each interval to a window, writing the results to out
+///
+/// Intervals outside the window become empty.  out must be at least as
+/// long as intervals, and may be the same span.
+///
+template <typename Position>
+void clip(
+    std::span<const interval<std::type_identity_t<Position>>> intervals,
+    const interval<Position>& window, std::span<interval<Position>> out) {
+  if (out.size() < intervals.size()) {
+    throw std::length_error("opaque::clip");
+  }
+  const auto ws = window.start.value;
+  const auto we = window.end.value;
+  for (std::size_t i = 0; i < intervals.size(); ++i) {
+    auto s = intervals[i].start.value;
+    auto e = intervals[i].end.value;
+    s = s < ws ? ws : s;
+    e = we < e ? we : e;
+    e = e < s ? s : e;
+    out[i].start.value = s;
+    out[i].end.value = e;
+  }
+}
+
+/// @}
+
+}
+
+#endif
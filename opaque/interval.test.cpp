@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/interval.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <random>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+struct bases : opaque::numeric_typedef<std::int64_t, bases> {
+  using base = opaque::numeric_typedef<std::int64_t, bases>;
+  using base::base;
+};
+
+struct locus : opaque::position_typedef<bases, locus> {
+  using base = opaque::position_typedef<bases, locus>;
+  using base::base;
+};
+
+using span_t = opaque::interval<locus>;
+
+static_assert(std::is_same_v<locus::distance_type, bases>);
+static_assert(std::is_same_v<decltype(span_t().length()), bases>);
+
+constexpr span_t gene(locus(100), locus(250));
+static_assert(gene.length() == bases(150));
+static_assert(span_t(locus(10), bases(5)).end == locus(15));
+static_assert(gene.contains(locus(100)) and not gene.contains(locus(250)));
+static_assert(gene.overlaps(span_t(locus(249), locus(300))));
+static_assert(not gene.overlaps(span_t(locus(250), locus(300))));
+static_assert(not gene.overlaps(span_t(locus(150), locus(150))));
+static_assert(gene.clip(span_t(locus(200), locus(400))) ==
+              span_t(locus(200), locus(250)));
+static_assert(gene.clip(span_t(locus(300), locus(400))).empty());
+static_assert(span_t(locus(5), locus(2)).length() == bases(0));
+
+TEST(bulk) {
+  std::mt19937_64 rng(1);
+  for (std::size_t n : { 0u, 1u, 63u, 64u, 65u, 1000u }) {
+    std::vector<span_t> v;
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto s = static_cast<std::int64_t>(rng() % 1000);
+      const auto len = static_cast<std::int64_t>(rng() % 50) - 5;
+      v.emplace_back(locus(s), locus(s + len));
+    }
+    const locus p(500);
+    const span_t q(locus(480), locus(520));
+    const auto at = opaque::overlaps(std::span(v), p);
+    const auto over = opaque::overlaps(std::span(v), q);
+    CHECK_EQUAL(n, at.size());
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+      CHECK_EQUAL(v[i].contains(p), at[i].value);
+      CHECK_EQUAL(v[i].overlaps(q), over[i].value);
+      count += v[i].overlaps(q);
+    }
+    CHECK_EQUAL(count, opaque::count_overlaps(std::span(v), q));
+    CHECK_EQUAL(count, over.count());
+    std::vector<span_t> clipped(n);
+    opaque::clip(std::span(v), q, std::span(clipped));
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto c = v[i].clip(q);
+      CHECK(c.empty() ? clipped[i].empty() : clipped[i] == c);
+    }
+  }
+  const span_t empty(locus(500), locus(500));
+  std::vector<span_t> one = { gene };
+  CHECK_EQUAL(0u, opaque::count_overlaps(std::span(one), empty));
+}
@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/interval_index.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <cstdint>
+#include <map>
+#include <random>
+#include <vector>
+
+struct bases : opaque::numeric_typedef<std::int64_t, bases> {
+  using base = opaque::numeric_typedef<std::int64_t, bases>;
+  using base::base;
+};
+
+struct locus : opaque::position_typedef<bases, locus> {
+  using base = opaque::position_typedef<bases, locus>;
+  using base::base;
+};
+
+using span_t = opaque::interval<locus>;
+using index_t = opaque::interval_index<locus, std::uint32_t>;
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 1000000);
+  const std::size_t queries = 10000;
+  const std::int64_t genome = 3000000000;
+  const std::int64_t max_len = 10000;
+  std::mt19937_64 rng(23);
+  std::vector<index_t::entry> entries;
+  for (std::size_t i = 0; i < n; ++i) {
+    const auto s = static_cast<std::int64_t>(rng() % genome);
+    const auto len = static_cast<std::int64_t>(rng() % max_len) + 1;
+    entries.push_back({ span_t(locus(s), bases(len)),
+                        static_cast<std::uint32_t>(i) });
+  }
+  std::vector<span_t> q;
+  for (std::size_t i = 0; i < queries; ++i) {
+    const auto s = static_cast<std::int64_t>(rng() % genome);
+    q.emplace_back(locus(s), bases(100000));
+  }
+
+  index_t idx;
+  measure("build interval_index (per entry)", n, [&] {
+    idx = index_t(entries);
+  });
+  std::multimap<std::int64_t, span_t> by_start;
+  measure("build multimap (per entry)", n, [&] {
+    for (const auto& e : entries) {
+      by_start.emplace(e.range.start.value, e.range);
+    }
+  });
+
+  measure("query interval_index", queries, [&] {
+    std::size_t hits = 0;
+    idx.for_each_overlap(std::span<const span_t>(q),
+        [&](std::size_t, const index_t::entry&) { ++hits; });
+    keep(hits);
+  });
+  // With a known maximum length, scan starts in [q.start - max_len, q.end)
+  measure("query multimap", queries, [&] {
+    std::size_t hits = 0;
+    for (const auto& iv : q) {
+      auto it = by_start.lower_bound(iv.start.value - max_len);
+      const auto stop = by_start.lower_bound(iv.end.value);
+      for (; it != stop; ++it) hits += it->second.overlaps(iv);
+    }
+    keep(hits);
+  });
+  const std::size_t scanned = queries / 100;
+  measure("query linear scan", scanned, [&] {
+    std::size_t hits = 0;
+    for (std::size_t i = 0; i < scanned; ++i) {
+      for (const auto& e : entries) hits += e.range.overlaps(q[i]);
+    }
+    keep(hits);
+  });
+}
@@ -0,0 +1,258 @@
+#ifndef OPAQUE_INTERVAL_INDEX_HPP
+#define OPAQUE_INTERVAL_INDEX_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/interval.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Static index of intervals answering overlap queries in O(log n + k)
+///
+/// This is an implicit augmented interval tree, in the style of cgranges:
+/// the entries are sorted by start in one contiguous array, which is also
+/// the in-order layout of a complete binary tree.  Each entry records the
+/// greatest end in its subtree, so queries skip subtrees that end before
+/// the query begins.  There are no child pointers and no per-node
+/// allocation, and small subtrees are scanned linearly.
+///
+/// Entries may be inserted at any time, but queries require build() to
+/// have been called since the last insertion.  Empty intervals are stored
+/// but never reported.
+///
+/// Template arguments:
+///  -# Position : A position_typedef
+///  -# V : The value associated with each interval
+///
+template <typename Position, typename V>
+class interval_index {
+  using raw_type = typename Position::underlying_type;
+
+public:
+  using position_type = Position;
+  using interval_type = interval<Position>;
+  using mapped_type   = V;
+  using size_type     = std::size_t;
+
+  struct entry {
+    interval_type range;
+    V             value;
+  };
+
+  interval_index() = default;
+
+  /// Index entries in any order
+  explicit interval_index(std::vector<entry> entries)
+    : entries_(std::move(entries)) { build(); }
+
+  ///
+  /// Index entries that are already sorted by start
+  ///
+  /// Throws std::invalid_argument if they are not.
+  ///
+  static interval_index from_sorted(std::span<const entry> sorted) {
+    interval_index r;
+    r.entries_.assign(sorted.begin(), sorted.end());
+    if (not std::is_sorted(r.entries_.begin(), r.entries_.end(), by_start)) {
+      throw std::invalid_argument("opaque::interval_index::from_sorted");
+    }
+    r.index();
+    return r;
+  }
+
+  size_type size()  const noexcept { return entries_.size(); }
+  bool      empty() const noexcept { return entries_.empty(); }
+  bool      built() const noexcept { return built_; }
+
+  /// The entries, sorted by start once built
+  std::span<const entry> entries() const noexcept { return entries_; }
+
+  void reserve(size_type n) { entries_.reserve(n); max_end_.reserve(n); }
+
+  void insert(const interval_type& range, V value) {
+    entries_.push_back({ range, std::move(value) });
+    built_ = false;
+  }
+
+  /// Sort the entries and compute the index
+  void build() {
+    std::sort(entries_.begin(), entries_.end(), by_start);
+    index();
+  }
+
+  /// Call f with each entry overlapping the query interval
+  template <typename F>
+  void for_each_overlap(const interval_type& q, F&& f) const {
+    if (q.empty()) return;
+    search<false>(q.start.value, q.end.value, f);
+  }
+
+  /// Call f with each entry containing the position
+  template <typename F>
+  void for_each_containing(const Position& p, F&& f) const {
+    search<true>(p.value, p.value, f);
+  }
+
+  /// Number of entries overlapping the query interval
+  size_type count_overlaps(const interval_type& q) const {
+    size_type n = 0;
+    for_each_overlap(q, [&](const entry&) { ++n; });
+    return n;
+  }
+
+  /// Number of entries containing the position
+  size_type count_containing(const Position& p) const {
+    size_type n = 0;
+    for_each_containing(p, [&](const entry&) { ++n; });
+    return n;
+  }
+
+  ///
+  /// Answer a batch of overlap queries
+  ///
+  /// f is called with the index of the query and each overlapping entry.
+  ///
+  template <typename F>
+  void for_each_overlap(std::span<const interval_type> queries, F&& f) const {
+    for (size_type i = 0; i < queries.size(); ++i) {
+      for_each_overlap(queries[i], [&](const entry& e) { f(i, e); });
+    }
+  }
+
+  /// Answer a batch of stabbing queries, as for_each_overlap
+  template <typename F>
+  void for_each_containing(std::span<const Position> points, F&& f) const {
+    for (size_type i = 0; i < points.size(); ++i) {
+      for_each_containing(points[i], [&](const entry& e) { f(i, e); });
+    }
+  }
+
+private:
+  static bool by_start(const entry& a, const entry& b) noexcept {
+    return a.range.start.value < b.range.start.value;
+  }
+
+  raw_type start(size_type i) const noexcept {
+    return entries_[i].range.start.value;
+  }
+  raw_type end(size_type i) const noexcept {
+    return entries_[i].range.end.value;
+  }
+
+  // Compute the subtree maximum ends.  Entry i is a node at level k, the
+  // number of trailing one bits of i; its children are i -/+ 2^(k-1).
+  void index() {
+    const size_type n = entries_.size();
+    max_end_.assign(n, raw_type());
+    levels_ = 0;
+    built_ = true;
+    if (n == 0) return;
+    size_type last_i = 0;
+    raw_type last = raw_type();
+    for (size_type i = 0; i < n; i += 2) {
+      last_i = i;
+      last = max_end_[i] = end(i);
+    }
+    unsigned k = 1;
+    for (; (size_type{1} << k) <= n; ++k) {
+      const size_type x = size_type{1} << (k - 1);
+      const size_type i0 = (x << 1) - 1;
+      const size_type step = x << 2;
+      for (size_type i = i0; i < n; i += step) {
+        const raw_type el = max_end_[i - x];
+        const raw_type er = i + x < n ? max_end_[i + x] : last;
+        raw_type e = end(i);
+        if (e < el) e = el;
+        if (e < er) e = er;
+        max_end_[i] = e;
+      }
+      last_i = ((last_i >> k) & 1) ? last_i - x : last_i + x;
+      if (last_i < n and last < max_end_[last_i]) last = max_end_[last_i];
+    }
+    levels_ = k - 1;
+  }
+
+  // Report entries with start < hi (or <= hi for a point) and end > lo
+  template <bool point, typename F>
+  void search(raw_type lo, raw_type hi, F& f) const {
+    if (not built_) {
+      throw std::logic_error("opaque::interval_index queried before build");
+    }
+    const size_type n = entries_.size();
+    if (n == 0) return;
+    const auto before_hi = [&](size_type i) {
+      if constexpr (point) return start(i) <= hi; else return start(i) < hi;
+    };
+    const auto report = [&](size_type i) {
+      if (lo < end(i) and start(i) < end(i)) f(entries_[i]);
+    };
+    struct frame { size_type x; unsigned k; bool left_done; };
+    frame stack[128];
+    unsigned top = 0;
+    stack[top++] = { (size_type{1} << levels_) - 1, levels_, false };
+    while (top) {
+      const frame z = stack[--top];
+      if (z.k <= 3) {
+        // Small subtree: scan its entries in order
+        const size_type i0 = z.x >> z.k << z.k;
+        size_type i1 = i0 + (size_type{1} << (z.k + 1)) - 1;
+        if (i1 > n) i1 = n;
+        for (size_type i = i0; i < i1 and before_hi(i); ++i) report(i);
+      } else if (not z.left_done) {
+        const size_type y = z.x - (size_type{1} << (z.k - 1));
+        stack[top++] = { z.x, z.k, true };
+        if (y >= n or lo < max_end_[y]) stack[top++] = { y, z.k - 1, false };
+      } else if (z.x < n and before_hi(z.x)) {
+        report(z.x);
+        stack[top++] = { z.x + (size_type{1} << (z.k - 1)), z.k - 1, false };
+      }
+    }
+  }
+
+  std::vector<entry>    entries_;
+  std::vector<raw_type> max_end_;
+  unsigned              levels_ = 0;
+  bool                  built_  = true;
+};
+
+/// @}
+
+}
+
+#endif
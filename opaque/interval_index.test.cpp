@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/interval_index.hpp"
+#include "arrtest/arrtest.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+struct bases : opaque::numeric_typedef<std::int64_t, bases> {
+  using base = opaque::numeric_typedef<std::int64_t, bases>;
+  using base::base;
+};
+
+struct locus : opaque::position_typedef<bases, locus> {
+  using base = opaque::position_typedef<bases, locus>;
+  using base::base;
+};
+
+using span_t = opaque::interval<locus>;
+using index_t = opaque::interval_index<locus, int>;
+
+template <typename F>
+std::vector<int> collect(F&& query) {
+  std::vector<int> r;
+  query([&](const index_t::entry& e) { r.push_back(e.value); });
+  std::sort(r.begin(), r.end());
+  return r;
+}
+
+TEST(small) {
+  index_t idx;
+  idx.insert(span_t(locus(10), locus(20)), 1);
+  idx.insert(span_t(locus(0), locus(5)), 2);
+  idx.insert(span_t(locus(15), locus(30)), 3);
+  idx.insert(span_t(locus(12), locus(12)), 4);
+  CHECK(not idx.built());
+  try {
+    idx.count_overlaps(span_t(locus(0), locus(1)));
+    CHECK_CATCH(std::logic_error, e);
+  }
+  idx.build();
+  CHECK_EQUAL(4u, idx.size());
+  CHECK(collect([&](auto f) { idx.for_each_containing(locus(15), f); }) ==
+        std::vector<int>({ 1, 3 }));
+  CHECK(collect([&](auto f) { idx.for_each_containing(locus(20), f); }) ==
+        std::vector<int>({ 3 }));
+  CHECK(collect([&](auto f) {
+          idx.for_each_overlap(span_t(locus(4), locus(11)), f); }) ==
+        std::vector<int>({ 1, 2 }));
+  CHECK_EQUAL(0u, idx.count_overlaps(span_t(locus(30), locus(40))));
+  CHECK_EQUAL(0u, idx.count_overlaps(span_t(locus(15), locus(15))));
+}
+
+TEST(random_against_scan) {
+  std::mt19937_64 rng(17);
+  for (std::size_t n : { 0u, 1u, 7u, 16u, 17u, 100u, 1000u, 5000u }) {
+    std::vector<index_t::entry> entries;
+    for (std::size_t i = 0; i < n; ++i) {
+      const auto s = static_cast<std::int64_t>(rng() % 10000);
+      const auto len = static_cast<std::int64_t>(rng() % 300);
+      entries.push_back({ span_t(locus(s), locus(s + len)),
+                          static_cast<int>(i) });
+    }
+    const index_t idx(entries);
+    std::vector<span_t> queries;
+    for (int q = 0; q < 50; ++q) {
+      const auto s = static_cast<std::int64_t>(rng() % 10500) - 200;
+      queries.emplace_back(locus(s), bases(static_cast<std::int64_t>(rng() % 500)));
+    }
+    std::vector<std::vector<int>> batched(queries.size());
+    idx.for_each_overlap(std::span<const span_t>(queries),
+        [&](std::size_t i, const index_t::entry& e) {
+          batched[i].push_back(e.value);
+        });
+    for (std::size_t q = 0; q < queries.size(); ++q) {
+      std::vector<int> expected, stab;
+      for (const auto& e : entries) {
+        if (e.range.overlaps(queries[q])) expected.push_back(e.value);
+        if (e.range.contains(queries[q].start)) stab.push_back(e.value);
+      }
+      std::sort(batched[q].begin(), batched[q].end());
+      CHECK(expected == batched[q]);
+      CHECK(stab == collect([&](auto f) {
+            idx.for_each_containing(queries[q].start, f); }));
+    }
+  }
+}
+
+TEST(from_sorted) {
+  std::vector<index_t::entry> sorted = {
+    { span_t(locus(1), locus(4)), 0 },
+    { span_t(locus(2), locus(3)), 1 },
+    { span_t(locus(8), locus(9)), 2 },
+  };
+  const auto idx = index_t::from_sorted(sorted);
+  CHECK_EQUAL(2u, idx.count_containing(locus(2)));
+  std::swap(sorted[0], sorted[2]);
+  try {
+    index_t::from_sorted(sorted);
+    CHECK_CATCH(std::invalid_argument, e);
+  }
+}
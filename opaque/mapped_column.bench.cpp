@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/mapped_column.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+struct user_id : opaque::numeric_typedef<std::uint64_t, user_id> {
+  using base = opaque::numeric_typedef<std::uint64_t, user_id>;
+  using base::base;
+};
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 20000000);
+  const auto path = std::filesystem::temp_directory_path() /
+    ("opaque-mapped_column-bench-" + std::to_string(::getpid()));
+  {
+    auto c = opaque::mapped_column<user_id>::create(path, n);
+    auto v = c.mutable_values();
+    for (std::size_t i = 0; i < n; ++i) v[i] = user_id(i);
+  }
+
+  measure("open: binary::read", n, [&] {
+    std::ifstream in(path, std::ios::binary);
+    std::vector<user_id> ids;
+    opaque::binary::read(in, ids);
+    keep(ids.size());
+  });
+  measure("open: mapped_column", n, [&] {
+    const opaque::mapped_column<user_id> c(path);
+    keep(c.size());
+  });
+  measure("open and scan: mapped_column", n, [&] {
+    const opaque::mapped_column<user_id> c(path);
+    c.advise(opaque::mapped_column<user_id>::pattern::sequential);
+    std::uint64_t sum = 0;
+    for (const auto& id : c) sum += id.value;
+    keep(sum);
+  });
+  std::filesystem::remove(path);
+}
@@ -0,0 +1,257 @@
+#ifndef OPAQUE_MAPPED_COLUMN_HPP
+#define OPAQUE_MAPPED_COLUMN_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/binary.hpp"
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Column of values stored in a memory-mapped file
+///
+/// The file holds an opaque::binary record: a header with the schema hash
+/// of O (which covers its name, underlying type, size and byte order) and
+/// the element count, followed by the elements.  Opening validates the
+/// header, then the elements are used in place, so opening costs the same
+/// for any size and pages are shared with other processes mapping the file.
+///
+/// A column opened read-only maps the file with PROT_READ; writing through
+/// it is impossible.  A read-write column writes through to the file.
+///
+/// Errors from the operating system throw std::system_error; a file that is
+/// not a column of O throws binary::error or binary::schema_mismatch.
+///
+template <typename O>
+class mapped_column {
+  static_assert(binary::serializable<O>);
+  static_assert(alignof(O) <= alignof(binary::header),
+      "elements must be aligned by the header that precedes them");
+
+public:
+  using value_type      = O;
+  using size_type       = std::size_t;
+  using const_iterator  = const O *;
+  using iterator        = const O *;
+
+  enum class access { read_only, read_write };
+
+  /// Expected access pattern, passed to the kernel as a hint
+  enum class pattern { normal, sequential, random, will_need, dont_need };
+
+  mapped_column() = default;
+
+  /// Map an existing column file
+  explicit mapped_column(const std::filesystem::path& path,
+      access mode = access::read_only) {
+    const int fd = open_fd(path,
+        mode == access::read_only ? O_RDONLY : O_RDWR);
+    fd_guard guard{fd};
+    struct stat st;
+    if (::fstat(fd, &st) != 0) fail("fstat");
+    const auto bytes = static_cast<std::size_t>(st.st_size);
+    if (bytes < sizeof(binary::header)) {
+      throw binary::error("opaque::mapped_column: truncated header");
+    }
+    map(fd, bytes, mode);
+    try {
+      std::memcpy(&header_, base_, sizeof(header_));
+      header_.check<O>();
+      if ((bytes - sizeof(header_)) / sizeof(O) < header_.count) {
+        throw binary::error("opaque::mapped_column: truncated column");
+      }
+    } catch (...) {
+      unmap();
+      throw;
+    }
+  }
+
+  ///
+  /// Create a column file of n value-initialized elements, mapped read-write
+  ///
+  /// An existing file is replaced.
+  ///
+  static mapped_column create(const std::filesystem::path& path,
+      size_type n) {
+    const int fd = open_fd(path, O_RDWR | O_CREAT | O_TRUNC);
+    fd_guard guard{fd};
+    const std::size_t bytes = binary::encoded_size<O>(n);
+    if (::ftruncate(fd, static_cast<off_t>(bytes)) != 0) fail("ftruncate");
+    mapped_column c;
+    c.map(fd, bytes, access::read_write);
+    c.header_ = binary::header::of<O>(n);
+    std::memcpy(c.base_, &c.header_, sizeof(c.header_));
+    // The file is zero-filled; only non-zero initial values need writing
+    if constexpr (not std::is_trivially_default_constructible_v<O>) {
+      for (auto& v : c.mutable_values()) v = O();
+    }
+    return c;
+  }
+
+  mapped_column(mapped_column&& other) noexcept
+    : base_(std::exchange(other.base_, nullptr))
+    , bytes_(std::exchange(other.bytes_, 0))
+    , header_(std::exchange(other.header_, binary::header{}))
+    , writable_(std::exchange(other.writable_, false)) { }
+
+  mapped_column& operator=(mapped_column&& other) noexcept {
+    mapped_column moved(std::move(other));
+    swap(moved);
+    return *this;
+  }
+
+  mapped_column(const mapped_column&) = delete;
+  mapped_column& operator=(const mapped_column&) = delete;
+
+  ~mapped_column() { unmap(); }
+
+  void swap(mapped_column& other) noexcept {
+    std::swap(base_, other.base_);
+    std::swap(bytes_, other.bytes_);
+    std::swap(header_, other.header_);
+    std::swap(writable_, other.writable_);
+  }
+
+  bool is_open()     const noexcept { return base_ != nullptr; }
+  bool is_writable() const noexcept { return writable_; }
+  size_type size()   const noexcept { return header_.count; }
+  bool empty()       const noexcept { return size() == 0; }
+
+  /// The elements, in place in the mapping
+  std::span<const O> values() const noexcept {
+    return { data(), size() };
+  }
+
+  /// The elements, for modification; throws if the column is read-only
+  std::span<O> mutable_values() {
+    if (not writable_) {
+      throw std::logic_error("opaque::mapped_column is read-only");
+    }
+    return { data(), size() };
+  }
+
+  const O& operator[](size_type i) const noexcept { return data()[i]; }
+
+  const_iterator begin() const noexcept { return data(); }
+  const_iterator end()   const noexcept { return data() + size(); }
+
+  /// Advise the kernel how the elements will be accessed
+  void advise(pattern p) const {
+    if (not base_) return;
+    int advice = POSIX_MADV_NORMAL;
+    switch (p) {
+      case pattern::normal:     advice = POSIX_MADV_NORMAL;     break;
+      case pattern::sequential: advice = POSIX_MADV_SEQUENTIAL; break;
+      case pattern::random:     advice = POSIX_MADV_RANDOM;     break;
+      case pattern::will_need:  advice = POSIX_MADV_WILLNEED;   break;
+      case pattern::dont_need:  advice = POSIX_MADV_DONTNEED;   break;
+    }
+    if (const int e = ::posix_madvise(base_, bytes_, advice)) {
+      throw std::system_error(e, std::generic_category(),
+          "opaque::mapped_column: posix_madvise");
+    }
+  }
+
+  /// Write modified pages back to the file, waiting for completion
+  void flush() const {
+    if (base_ and writable_ and ::msync(base_, bytes_, MS_SYNC) != 0) {
+      fail("msync");
+    }
+  }
+
+private:
+  struct fd_guard {
+    int fd;
+    ~fd_guard() { ::close(fd); }
+  };
+
+  [[noreturn]] static void fail(const char * what) {
+    throw std::system_error(errno, std::generic_category(),
+        std::string("opaque::mapped_column: ") + what);
+  }
+
+  static int open_fd(const std::filesystem::path& path, int flags) {
+    const int fd = ::open(path.c_str(), flags | O_CLOEXEC, 0666);
+    if (fd < 0) fail("open");
+    return fd;
+  }
+
+  void map(int fd, std::size_t bytes, access mode) {
+    writable_ = mode == access::read_write;
+    void * p = ::mmap(nullptr, bytes,
+        writable_ ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+    if (p == MAP_FAILED) fail("mmap");
+    base_ = static_cast<std::byte *>(p);
+    bytes_ = bytes;
+  }
+
+  void unmap() noexcept {
+    if (base_) ::munmap(base_, bytes_);
+    base_ = nullptr;
+    bytes_ = 0;
+    header_ = binary::header{};
+    writable_ = false;
+  }
+
+  O * data() const noexcept {
+    if (not base_) return nullptr;
+    return std::launder(static_cast<O *>(
+          static_cast<void *>(base_ + sizeof(binary::header))));
+  }
+
+  std::byte *    base_     = nullptr;
+  std::size_t    bytes_    = 0;
+  binary::header header_   = {};
+  bool           writable_ = false;
+};
+
+template <typename O>
+void swap(mapped_column<O>& a, mapped_column<O>& b) noexcept { a.swap(b); }
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,122 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/mapped_column.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+struct user_id : opaque::numeric_typedef<std::uint64_t, user_id> {
+  using base = opaque::numeric_typedef<std::uint64_t, user_id>;
+  using base::base;
+};
+
+struct group_id : opaque::numeric_typedef<std::uint64_t, group_id> {
+  using base = opaque::numeric_typedef<std::uint64_t, group_id>;
+  using base::base;
+};
+
+using column = opaque::mapped_column<user_id>;
+
+static std::filesystem::path scratch(const char * name) {
+  return std::filesystem::temp_directory_path() /
+    (std::string("opaque-mapped_column-") + std::to_string(::getpid()) +
+     "-" + name);
+}
+
+TEST(create_and_open) {
+  const auto path = scratch("ids");
+  {
+    auto c = column::create(path, 1000);
+    CHECK_EQUAL(1000u, c.size());
+    CHECK(c.is_writable());
+    CHECK(c[999] == user_id(0u));
+    auto v = c.mutable_values();
+    for (std::size_t i = 0; i < v.size(); ++i) v[i] = user_id(i * 3);
+    c.flush();
+  }
+  {
+    const column c(path);
+    CHECK(not c.is_writable());
+    CHECK_EQUAL(1000u, c.size());
+    c.advise(column::pattern::sequential);
+    std::uint64_t sum = 0;
+    for (const auto& id : c) sum += id.value;
+    CHECK_EQUAL(3u * 999u * 1000u / 2u, sum);
+    try {
+      const_cast<column&>(c).mutable_values();
+      CHECK_CATCH(std::logic_error, e);
+    }
+  }
+  {
+    column c(path, column::access::read_write);
+    c.mutable_values()[5] = user_id(7u);
+  }
+  CHECK(column(path)[5] == user_id(7u));
+  std::filesystem::remove(path);
+}
+
+TEST(binary_compatible) {
+  // A column file is an opaque::binary record
+  const auto path = scratch("binary");
+  std::vector<user_id> ids = { user_id(4u), user_id(5u), user_id(6u) };
+  {
+    std::ofstream out(path, std::ios::binary);
+    opaque::binary::write(out, std::span<const user_id>(ids));
+  }
+  column c(path);
+  CHECK(std::equal(ids.begin(), ids.end(), c.values().begin(), c.values().end()));
+  column moved(std::move(c));
+  CHECK(not c.is_open());
+  CHECK_EQUAL(3u, moved.size());
+  std::filesystem::remove(path);
+}
+
+TEST(errors) {
+  const auto path = scratch("groups");
+  opaque::mapped_column<group_id>::create(path, 10);
+  try {
+    column c(path);
+    CHECK_CATCH(opaque::binary::schema_mismatch, e);
+  }
+  std::filesystem::resize_file(path, 100);
+  try {
+    opaque::mapped_column<group_id> c(path);
+    CHECK_CATCH(opaque::binary::error, e);
+  }
+  std::filesystem::remove(path);
+  try {
+    column c(path);
+    CHECK_CATCH(std::system_error, e);
+  }
+}
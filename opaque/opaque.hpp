@@ -1,7 +1,7 @@
 #ifndef OPAQUE_HPP
 #define OPAQUE_HPP
 //
-// Copyright (c) 2015
+// Copyright (c) 2015, 2026
 // Kyle Markley.  All rights reserved.
 //
 // Redistribution and use in source and binary forms, with or without
@@ -53,6 +53,14 @@ namespace binop { }
 ///
 namespace experimental { }
 
+///
+/// Binary Serialization
+///
+/// Raw serialization of trivially copyable types, including structs of
+/// opaque typedefs, guarded by a schema hash of the serialized type.
+///
+namespace binary { }
+
 }
 
 ///
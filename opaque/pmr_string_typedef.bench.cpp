@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/pmr_string_typedef.hpp"
+#include "opaque/safer_string_typedef.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <string_view>
+
+//
+// Count heap allocations so that the report shows what each request costs
+//
+static std::atomic<std::size_t> allocations{0};
+
+void * operator new(std::size_t n) {
+  ++allocations;
+  if (void * p = std::malloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void * p) noexcept { std::free(p); }
+void operator delete(void * p, std::size_t) noexcept { std::free(p); }
+
+struct heap_string
+  : opaque::experimental::safer_string_typedef<std::string, heap_string> {
+  using base = opaque::experimental::safer_string_typedef<std::string, heap_string>;
+  using base::base;
+};
+
+struct arena_string
+  : opaque::experimental::pmr_string_typedef<arena_string> {
+  using base = opaque::experimental::pmr_string_typedef<arena_string>;
+  using base::base;
+};
+
+// The fields of a typical request, most beyond the small string buffer
+static constexpr std::string_view fields[] = {
+  "/api/v2/accounts/8412/orders", "application/json; charset=utf-8",
+  "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36",
+  "session=4f9a1c22e7b04d6a8e0f; theme=dark", "gzip, deflate, br",
+  "en-US,en;q=0.9", "keep-alive", "https://example.com/dashboard",
+};
+
+template <typename Make>
+static std::size_t handle_request(Make&& make) {
+  std::size_t total = 0;
+  for (const auto& f : fields) {
+    auto s = make(f);
+    auto prefix = s.substr(0, 12);
+    auto joined = prefix + s;
+    auto copy = joined;
+    total += copy.size();
+  }
+  return total;
+}
+
+template <typename F>
+static void run(const char * label, std::size_t n, F&& f) {
+  const std::size_t before = allocations;
+  measure(label, n, f);
+  std::printf("%52s %12.2f allocations/request\n", "",
+      static_cast<double>(allocations - before) / static_cast<double>(n));
+}
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 500000);
+
+  run("safer_string_typedef<std::string> per request", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      keep(handle_request([](std::string_view f) {
+        return heap_string(f.data(), f.size());
+      }));
+    }
+  });
+  opaque::experimental::request_arena<> arena;
+  run("pmr_string_typedef + request_arena per request", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      keep(handle_request([&](std::string_view f) {
+        return arena.make<arena_string>(f);
+      }));
+      arena.reset();
+    }
+  });
+}
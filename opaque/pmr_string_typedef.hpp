@@ -0,0 +1,155 @@
+#ifndef OPAQUE_PMR_STRING_TYPEDEF_HPP
+#define OPAQUE_PMR_STRING_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/safer_string_typedef.hpp"
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace opaque {
+namespace experimental {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Safer string typedef allocating from a std::pmr::memory_resource
+///
+/// Unlike a plain std::pmr::string, every string derived from an instance
+/// stays in that instance's memory resource: copies, substr, and operator+
+/// with the instance as left operand all allocate from it, whatever the
+/// resource of the right operand.  (Assignment keeps the resource of the
+/// target, as for any std::pmr container.)
+///
+/// Combined with a request_arena, this lets request-scoped strings bypass
+/// the global allocator entirely and be released together.
+///
+/// Template arguments:
+///  -# R : The result type, your subclass
+///  -# CharT : The character type
+///  -# Traits : The character traits type
+///
+template <typename R, typename CharT = char,
+         typename Traits = std::char_traits<CharT>>
+struct pmr_string_typedef
+  : safer_string_typedef<std::pmr::basic_string<CharT, Traits>, R> {
+private:
+  using base = safer_string_typedef<std::pmr::basic_string<CharT, Traits>, R>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using typename base::allocator_type;
+  using base::value;
+  using view_type = std::basic_string_view<CharT, Traits>;
+
+  using base::base;
+
+  pmr_string_typedef() = default;
+
+  /// An empty string allocating from r
+  explicit pmr_string_typedef(std::pmr::memory_resource * r) noexcept
+    : base(allocator_type(r)) { }
+
+  /// A copy of s allocated from r
+  pmr_string_typedef(view_type s, std::pmr::memory_resource * r)
+    : base(s.data(), s.size(), allocator_type(r)) { }
+  pmr_string_typedef(const CharT * s, std::pmr::memory_resource * r)
+    : base(s, allocator_type(r)) { }
+
+  /// The copy allocates from the same resource as the original
+  pmr_string_typedef(const pmr_string_typedef& other)
+    : base(underlying_type(other.value, other.value.get_allocator())) { }
+
+  pmr_string_typedef(pmr_string_typedef&&) noexcept = default;
+  pmr_string_typedef& operator=(const pmr_string_typedef&) = default;
+  pmr_string_typedef& operator=(pmr_string_typedef&&) = default;
+
+  std::pmr::memory_resource * resource() const noexcept {
+    return value.get_allocator().resource();
+  }
+
+protected:
+  ~pmr_string_typedef() = default;
+};
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Monotonic arena for objects that live as long as one request
+///
+/// Allocation bumps a pointer, first within an inline buffer and then in
+/// blocks obtained from the upstream resource, and deallocation does
+/// nothing.  reset() releases everything at once and makes the inline
+/// buffer available again, so a request that fits in it never touches the
+/// upstream resource.
+///
+/// Strings and containers using the arena must not outlive the next
+/// reset() or the arena itself.
+///
+/// Template arguments:
+///  -# InlineBytes : Size of the inline buffer
+///
+template <std::size_t InlineBytes = 4096>
+class request_arena {
+public:
+  explicit request_arena(
+      std::pmr::memory_resource * upstream = std::pmr::get_default_resource())
+    : resource_(buffer_, InlineBytes, upstream) { }
+
+  request_arena(const request_arena&) = delete;
+  request_arena& operator=(const request_arena&) = delete;
+
+  std::pmr::memory_resource * resource() noexcept { return &resource_; }
+
+  /// Construct an R from args followed by this arena's resource
+  template <typename R, typename... Args>
+  R make(Args&&... args) {
+    return R(std::forward<Args>(args)..., resource());
+  }
+
+  /// Release every allocation made since construction or the last reset
+  void reset() noexcept { resource_.release(); }
+
+private:
+  alignas(std::max_align_t) std::byte buffer_[InlineBytes];
+  std::pmr::monotonic_buffer_resource resource_;
+};
+
+/// @}
+
+}
+}
+
+#endif
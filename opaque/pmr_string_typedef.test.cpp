@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/pmr_string_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+
+UNIT_TEST_MAIN
+
+using opaque::experimental::request_arena;
+
+struct header_value
+  : opaque::experimental::pmr_string_typedef<header_value> {
+  using base = opaque::experimental::pmr_string_typedef<header_value>;
+  using base::base;
+};
+
+static_assert(not std::is_convertible_v<std::pmr::string, header_value>);
+static_assert(not std::is_convertible_v<const char *, header_value>);
+
+//
+// A resource that counts what it hands out, to see where strings live
+//
+struct counting_resource : std::pmr::memory_resource {
+  std::size_t allocations = 0;
+  void * do_allocate(std::size_t n, std::size_t a) override {
+    ++allocations;
+    return std::pmr::new_delete_resource()->allocate(n, a);
+  }
+  void do_deallocate(void * p, std::size_t n, std::size_t a) override {
+    std::pmr::new_delete_resource()->deallocate(p, n, a);
+  }
+  bool do_is_equal(const memory_resource& o) const noexcept override {
+    return this == &o;
+  }
+};
+
+constexpr const char * long_text =
+  "text well beyond the small string buffer of std::string";
+
+TEST(construct_in_resource) {
+  counting_resource r;
+  const header_value h(long_text, &r);
+  CHECK_EQUAL(&r, h.resource());
+  CHECK_EQUAL(1u, r.allocations);
+  const header_value e(&r);
+  CHECK_EQUAL(true, e.empty());
+  CHECK_EQUAL(&r, e.resource());
+}
+
+TEST(propagation) {
+  counting_resource r;
+  const header_value h(long_text, &r);
+  const header_value copy(h);
+  CHECK_EQUAL(&r, copy.resource());
+  CHECK_EQUAL(true, copy == h);
+  const header_value sub = h.substr(5, 40);
+  CHECK_EQUAL(&r, sub.resource());
+  CHECK_EQUAL(true, sub == header_value(std::pmr::string(
+          std::string(long_text).substr(5, 40))));
+  const header_value sum = h + copy;
+  CHECK_EQUAL(&r, sum.resource());
+  CHECK_EQUAL(2 * h.size(), sum.size());
+  header_value appended(h);
+  appended.append(h);
+  CHECK_EQUAL(&r, appended.resource());
+  // h, copy, sub, sum, appended, and appended growing
+  CHECK_EQUAL(6u, r.allocations);
+  header_value target(std::pmr::get_default_resource());
+  target = h;
+  CHECK_EQUAL(std::pmr::get_default_resource(), target.resource());
+}
+
+TEST(sum_keeps_left_resource) {
+  counting_resource left, right;
+  const header_value l(long_text, &left);
+  CHECK_EQUAL(&left, (l + header_value(long_text, &right)).resource());
+  CHECK_EQUAL(&left, (header_value(long_text, &left) +
+        header_value(long_text, &right)).resource());
+  CHECK_EQUAL(&left, (header_value(long_text, &left) +
+        static_cast<const header_value&>(header_value(long_text, &right)))
+      .resource());
+  const header_value sum = l + header_value(long_text, &right);
+  CHECK_EQUAL(2 * l.size(), sum.size());
+  CHECK(sum.substr(l.size()) == l);
+}
+
+TEST(arena) {
+  counting_resource upstream;
+  request_arena<256> arena(&upstream);
+  for (int request = 0; request < 10; ++request) {
+    const auto a = arena.make<header_value>("content-type");
+    const auto b = arena.make<header_value>(long_text);
+    const header_value c = a + b;
+    CHECK_EQUAL(arena.resource(), c.resource());
+    arena.reset();
+  }
+  // Every request fitted in the inline buffer
+  CHECK_EQUAL(0u, upstream.allocations);
+  for (int i = 0; i < 20; ++i) (void)arena.make<header_value>(long_text);
+  CHECK(upstream.allocations > 0);
+}
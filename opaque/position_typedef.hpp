@@ -1,7 +1,7 @@
 #ifndef OPAQUE_POSITION_TYPEDEF_HPP
 #define OPAQUE_POSITION_TYPEDEF_HPP
 //
-// Copyright (c) 2016, 2021
+// Copyright (c) 2016, 2021, 2026
 // Kyle Markley.  All rights reserved.
 //
 // Redistribution and use in source and binary forms, with or without
@@ -71,6 +71,7 @@ private:
 public:
   using typename base::underlying_type;
   using typename base::opaque_type;
+  using distance_type = Distance;
   using base::value;
 
   opaque_type& operator+=(const opaque_type&) = delete;
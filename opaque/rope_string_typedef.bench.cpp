@@ -0,0 +1,89 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/rope_string_typedef.hpp"
+#include "opaque/safer_string_typedef.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <fcntl.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+struct flat_response
+  : opaque::experimental::safer_string_typedef<std::string, flat_response> {
+  using base = opaque::experimental::safer_string_typedef<std::string, flat_response>;
+  using base::base;
+};
+
+struct rope_response
+  : opaque::experimental::rope_string_typedef<rope_response> {
+  using base = opaque::experimental::rope_string_typedef<rope_response>;
+  using base::base;
+};
+
+int main(int argc, char * argv[]) {
+  // Output size in megabytes
+  const std::size_t mb = bench_size(argc, argv, 100);
+  const std::size_t bytes = mb << 20;
+
+  std::vector<std::string> parts;
+  for (int i = 0; i < 256; ++i) {
+    parts.push_back("{\"id\":" + std::to_string(i * 7919) +
+        ",\"name\":\"record\",\"tags\":[\"a\",\"b\",\"c\"]},\n");
+  }
+  const int fd = ::open("/dev/null", O_WRONLY);
+
+  flat_response flat;
+  measure("safer_string_typedef build, per byte", bytes, [&] {
+    for (std::size_t i = 0; flat.size() < bytes; ++i) {
+      flat += flat_response(parts[i % parts.size()]);
+    }
+  });
+  measure("safer_string_typedef write, per byte", bytes, [&] {
+    keep(::write(fd, flat.data(), flat.size()));
+  });
+
+  rope_response rope;
+  measure("rope_string_typedef build, per byte", bytes, [&] {
+    for (std::size_t i = 0; rope.size() < bytes; ++i) {
+      rope += parts[i % parts.size()];
+    }
+  });
+  measure("rope_string_typedef write (writev), per byte", bytes, [&] {
+    rope.write(fd);
+  });
+  std::printf("%52s %12zu chunks\n", "", rope.chunk_count());
+
+  measure("safer_string_typedef substr + concat of halves", 1, [&] {
+    keep((flat.substr(0, bytes / 2) + flat.substr(bytes / 2)).size());
+  });
+  measure("rope_string_typedef substr + concat of halves", 1, [&] {
+    keep((rope.substr(0, bytes / 2) + rope.substr(bytes / 2)).size());
+  });
+  ::close(fd);
+}
@@ -0,0 +1,415 @@
+#ifndef OPAQUE_ROPE_STRING_TYPEDEF_HPP
+#define OPAQUE_ROPE_STRING_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/storage.hpp"
+#include "opaque/safer_string_typedef.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+#if __has_include(<sys/uio.h>) and __has_include(<unistd.h>)
+#include <climits>
+#include <sys/uio.h>
+#include <unistd.h>
+#define OPAQUE_ROPE_HAS_WRITEV 1
+#endif
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+///
+/// Block of characters shared by the pieces of ropes
+///
+/// Characters below the frontier are immutable.  A rope whose last piece
+/// ends at the frontier may claim the bytes after it and append there;
+/// claiming is atomic, so ropes sharing the block never write the same
+/// bytes, even from different threads.
+///
+struct rope_block {
+  explicit rope_block(std::size_t n)
+    : bytes(std::make_unique_for_overwrite<char[]>(n)), capacity(n) { }
+
+  /// Claim n bytes at offset at; null unless at is the frontier
+  char * claim(std::size_t at, std::size_t n) noexcept {
+    std::size_t expected = at;
+    if (n > capacity - at or not frontier.compare_exchange_strong(expected,
+          at + n, std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return bytes.get() + at;
+  }
+
+  std::unique_ptr<char[]> bytes;
+  std::size_t capacity;
+  std::atomic<std::size_t> frontier{0};
+};
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// String stored as a sequence of shared, immutable pieces
+///
+/// Appending copies only the appended characters, into spare capacity of
+/// the last block when possible, and otherwise into a new block at least
+/// as large as the rope (from 4 KiB to 1 MiB), so appending is amortized
+/// O(1) per character and a rope of n bytes has O(log n + n / 1 MiB)
+/// pieces.  Copies, substr and concatenation share blocks instead of
+/// copying characters.  The pieces can be visited in order, or handed
+/// straight to writev.
+///
+class rope {
+public:
+  using value_type  = char;
+  using traits_type = std::char_traits<char>;
+  using size_type   = std::size_t;
+  static constexpr size_type npos = size_type(-1);
+
+  static constexpr size_type min_block = 4096;
+  static constexpr size_type max_block = size_type{1} << 20;
+
+  rope() = default;
+  explicit rope(std::string_view s) { append(s); }
+
+  size_type  size() const noexcept {
+    return pieces_.empty() ? 0 : pieces_.back().end;
+  }
+  bool      empty() const noexcept { return pieces_.empty(); }
+  size_type chunk_count() const noexcept { return pieces_.size(); }
+
+  rope& append(std::string_view s) {
+    if (s.empty()) return *this;
+    if (not pieces_.empty()) {
+      piece& p = pieces_.back();
+      const auto at = static_cast<size_type>(p.data + p.size -
+          p.block->bytes.get());
+      const size_type n = std::min(s.size(), p.block->capacity - at);
+      if (char * d = p.block->claim(at, n)) {
+        std::memcpy(d, s.data(), n);
+        p.size += n;
+        p.end += n;
+        s.remove_prefix(n);
+        if (s.empty()) return *this;
+      }
+    }
+    const size_type capacity =
+      std::max(s.size(), std::clamp(size(), min_block, max_block));
+    auto block = std::make_shared<detail::rope_block>(capacity);
+    char * d = block->claim(0, s.size());
+    std::memcpy(d, s.data(), s.size());
+    pieces_.push_back({ std::move(block), d, s.size(), size() + s.size() });
+    return *this;
+  }
+
+  rope& append(const rope& r) {
+    const size_type n = r.pieces_.size();
+    pieces_.reserve(pieces_.size() + n);
+    for (size_type i = 0; i < n; ++i) push_piece(r.pieces_[i]);
+    return *this;
+  }
+
+  rope& operator+=(std::string_view s) { return append(s); }
+  rope& operator+=(const rope& r) { return append(r); }
+  rope& operator+=(char c) { return append(std::string_view(&c, 1)); }
+
+  friend rope operator+(rope l, const rope& r) {
+    l.append(r);
+    return l;
+  }
+
+  void clear() noexcept { pieces_.clear(); }
+
+  /// The characters [pos, pos + n), sharing this rope's blocks
+  rope substr(size_type pos = 0, size_type n = npos) const {
+    if (pos > size()) throw std::out_of_range("opaque::rope::substr");
+    n = std::min(n, size() - pos);
+    rope r;
+    for (size_type i = piece_of(pos); n != 0; ++i) {
+      const piece& p = pieces_[i];
+      const size_type skip = pos - (p.end - p.size);
+      const size_type take = std::min(n, p.size - skip);
+      r.push_piece({ p.block, p.data + skip, take, 0 });
+      pos += take;
+      n -= take;
+    }
+    return r;
+  }
+
+  /// The character at pos, found by binary search of the pieces
+  char operator[](size_type pos) const noexcept {
+    const piece& p = pieces_[piece_of(pos)];
+    return p.data[pos - (p.end - p.size)];
+  }
+  char at(size_type pos) const {
+    if (pos >= size()) throw std::out_of_range("opaque::rope::at");
+    return (*this)[pos];
+  }
+
+  /// Call f with a std::string_view of each piece in order
+  template <typename F>
+  void for_each_chunk(F&& f) const {
+    for (const auto& p : pieces_) f(std::string_view(p.data, p.size));
+  }
+
+  std::vector<std::string_view> chunks() const {
+    std::vector<std::string_view> r;
+    r.reserve(pieces_.size());
+    for_each_chunk([&](std::string_view c) { r.push_back(c); });
+    return r;
+  }
+
+  /// Copy the characters into a contiguous string
+  template <typename S = std::string>
+  S flatten() const {
+    S s;
+    s.reserve(size());
+    for_each_chunk([&](std::string_view c) { s.append(c.data(), c.size()); });
+    return s;
+  }
+
+  int compare(const rope& o) const noexcept {
+    size_type i = 0, j = 0, a = 0, b = 0;
+    while (i < pieces_.size() and j < o.pieces_.size()) {
+      const piece& p = pieces_[i];
+      const piece& q = o.pieces_[j];
+      const size_type n = std::min(p.size - a, q.size - b);
+      if (const int c = std::memcmp(p.data + a, q.data + b, n)) return c;
+      a += n;
+      b += n;
+      if (a == p.size) { ++i; a = 0; }
+      if (b == q.size) { ++j; b = 0; }
+    }
+    return size() < o.size() ? -1 : size() > o.size() ? 1 : 0;
+  }
+
+  friend bool operator==(const rope& a, const rope& b) noexcept {
+    return a.size() == b.size() and a.compare(b) == 0;
+  }
+  friend std::strong_ordering operator<=>(const rope& a, const rope& b)
+    noexcept {
+    return a.compare(b) <=> 0;
+  }
+
+#if defined(OPAQUE_ROPE_HAS_WRITEV)
+  ///
+  /// Write every character to a file descriptor, up to IOV_MAX pieces per
+  /// writev call; throws std::system_error on failure
+  ///
+  void write(int fd) const {
+    std::vector<iovec> iov;
+    iov.reserve(std::min<size_type>(pieces_.size(), IOV_MAX));
+    for (size_type first = 0; first < pieces_.size(); ) {
+      iov.clear();
+      for (size_type i = first; i < pieces_.size() and iov.size() < IOV_MAX;
+          ++i) {
+        iov.push_back({ const_cast<char *>(pieces_[i].data), pieces_[i].size });
+      }
+      first += iov.size();
+      for (size_type k = 0; k < iov.size(); ) {
+        const ssize_t n = ::writev(fd, iov.data() + k,
+            static_cast<int>(iov.size() - k));
+        if (n < 0) {
+          if (errno == EINTR) continue;
+          throw std::system_error(errno, std::generic_category(),
+              "opaque::rope::write");
+        }
+        auto done = static_cast<size_type>(n);
+        while (k < iov.size() and done >= iov[k].iov_len) {
+          done -= iov[k++].iov_len;
+        }
+        if (k < iov.size()) {
+          iov[k].iov_base = static_cast<char *>(iov[k].iov_base) + done;
+          iov[k].iov_len -= done;
+        }
+      }
+    }
+  }
+#endif
+
+private:
+  struct piece {
+    std::shared_ptr<detail::rope_block> block;
+    const char * data;
+    size_type size;
+    size_type end;    // offset in the rope just past this piece
+  };
+
+  /// Index of the piece holding offset pos
+  size_type piece_of(size_type pos) const noexcept {
+    return static_cast<size_type>(std::upper_bound(pieces_.begin(),
+          pieces_.end(), pos, [](size_type x, const piece& p) {
+            return x < p.end;
+          }) - pieces_.begin());
+  }
+
+  /// Append a piece, merging it with the last one if they are adjacent
+  void push_piece(piece p) {
+    if (p.size == 0) return;
+    p.end = size() + p.size;
+    if (not pieces_.empty()) {
+      piece& last = pieces_.back();
+      if (last.block == p.block and last.data + last.size == p.data) {
+        last.size += p.size;
+        last.end = p.end;
+        return;
+      }
+    }
+    pieces_.push_back(std::move(p));
+  }
+
+  std::vector<piece> pieces_;
+};
+
+/// @}
+
+namespace experimental {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// String typedef stored as a rope, for building large strings piecewise
+///
+/// Appending never moves the characters already present, and copies,
+/// substr and concatenation share storage, so a response of many megabytes
+/// can be assembled from many parts at a cost proportional to the parts.
+/// The pieces can be written with writev (write()) or visited in order;
+/// conversion to a safer_string_typedef flattens them on demand.
+///
+/// Template arguments:
+///  -# O : The result type, your subclass
+///
+template <typename O>
+struct rope_string_typedef : opaque_storage<opaque::rope, O> {
+private:
+  using base = opaque_storage<opaque::rope, O>;
+public:
+  using underlying_type = opaque::rope;
+  using     opaque_type = O;
+  using base::value;
+
+  using value_type  = char;
+  using traits_type = std::char_traits<char>;
+  using size_type   = std::size_t;
+  static constexpr size_type npos = underlying_type::npos;
+
+  rope_string_typedef() = default;
+
+  explicit rope_string_typedef(std::string_view s) : base(s) { }
+
+  template <typename S, typename R>
+    requires std::same_as<typename S::value_type, char>
+  explicit rope_string_typedef(const safer_string_typedef<S,R>& s)
+    : base(std::string_view(s.value.data(), s.value.size())) { }
+
+  /// Copy the characters into a safer_string_typedef
+  template <typename R>
+    requires std::derived_from<R,
+      safer_string_typedef<typename R::underlying_type, R>>
+  explicit operator R() const {
+    return R(value.template flatten<typename R::underlying_type>());
+  }
+
+  size_type  size() const noexcept { return value.size(); }
+  bool      empty() const noexcept { return value.empty(); }
+  size_type chunk_count() const noexcept { return value.chunk_count(); }
+
+  /// Append a copy of some characters
+  opaque_type& append(std::string_view s) {
+    value.append(s);
+    return this->downcast();
+  }
+  /// Append another instance, sharing its storage
+  opaque_type& append(const opaque_type& s) {
+    value.append(s.value);
+    return this->downcast();
+  }
+  opaque_type& operator+=(std::string_view s) { return append(s); }
+  opaque_type& operator+=(const opaque_type& s) { return append(s); }
+  opaque_type& operator+=(char c) {
+    return append(std::string_view(&c, 1));
+  }
+
+  friend opaque_type operator+(opaque_type l, const opaque_type& r) {
+    l.append(r);
+    return l;
+  }
+
+  void clear() noexcept { value.clear(); }
+
+  opaque_type substr(size_type pos = 0, size_type n = npos) const {
+    opaque_type r;
+    r.value = value.substr(pos, n);
+    return r;
+  }
+
+  char operator[](size_type pos) const noexcept { return value[pos]; }
+  char at(size_type pos) const { return value.at(pos); }
+
+  int compare(const opaque_type& s) const noexcept {
+    return value.compare(s.value);
+  }
+
+  template <typename F>
+  void for_each_chunk(F&& f) const { value.for_each_chunk(std::forward<F>(f)); }
+
+  std::vector<std::string_view> chunks() const { return value.chunks(); }
+
+  /// The characters as one contiguous std::string
+  std::string str() const { return value.flatten(); }
+
+#if defined(OPAQUE_ROPE_HAS_WRITEV)
+  void write(int fd) const { value.write(fd); }
+#endif
+};
+
+/// @}
+
+}
+}
+
+#endif
@@ -0,0 +1,121 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/rope_string_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdio>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unistd.h>
+
+UNIT_TEST_MAIN
+
+struct response : opaque::experimental::rope_string_typedef<response> {
+  using base = opaque::experimental::rope_string_typedef<response>;
+  using base::base;
+};
+
+struct body : opaque::experimental::safer_string_typedef<std::string, body> {
+  using base = opaque::experimental::safer_string_typedef<std::string, body>;
+  using base::base;
+};
+
+static_assert(not std::is_convertible_v<std::string, response>);
+static_assert(not std::is_convertible_v<body, response>);
+static_assert(not std::is_convertible_v<response, body>);
+static_assert(std::is_constructible_v<body, response>);
+
+TEST(append_matches_string) {
+  std::mt19937 rng(3);
+  response r;
+  std::string ref;
+  for (int i = 0; i < 5000; ++i) {
+    const std::string part(rng() % 700, char('a' + i % 26));
+    r += part;
+    ref += part;
+  }
+  CHECK_EQUAL(ref.size(), r.size());
+  CHECK(r.str() == ref);
+  // Geometric blocks keep the piece count small
+  CHECK(r.chunk_count() < 40);
+  for (std::size_t i = 0; i < ref.size(); i += 997) {
+    CHECK_EQUAL(ref[i], r[i]);
+  }
+}
+
+TEST(sharing) {
+  response a("head:");
+  response b = a;
+  a += "left";
+  b += "right";
+  CHECK(a.str() == "head:left");
+  CHECK(b.str() == "head:right");
+  const response c = a + b;
+  CHECK(c.str() == "head:lefthead:right");
+  const response sub = c.substr(3, 10);
+  CHECK(sub.str() == "d:lefthead");
+  CHECK(sub == response("d:lefthead"));
+  CHECK(sub < response("e"));
+  try {
+    (void)c.substr(100);
+    CHECK_CATCH(std::out_of_range, e);
+  }
+  response self("ab");
+  self += self;
+  self += self;
+  CHECK(self.str() == "abababab");
+}
+
+TEST(flatten) {
+  response r(body("status: ok\n"));
+  r += "payload";
+  const auto b = static_cast<body>(r);
+  CHECK(b == body("status: ok\npayload"));
+}
+
+TEST(chunks_and_write) {
+  response r;
+  std::string ref;
+  for (int i = 0; i < 2000; ++i) {
+    const std::string line = "line " + std::to_string(i) + "\n";
+    r += line;
+    ref += line;
+  }
+  std::string joined;
+  for (auto c : r.chunks()) joined += c;
+  CHECK(joined == ref);
+
+  std::FILE * f = std::tmpfile();
+  r.write(fileno(f));
+  std::rewind(f);
+  std::string back(ref.size(), '\0');
+  CHECK_EQUAL(ref.size(), std::fread(back.data(), 1, back.size(), f));
+  std::fclose(f);
+  CHECK(back == ref);
+}
@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/safer_string_typedef.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <random>
+#include <string>
+#include <vector>
+
+struct log_line
+  : opaque::experimental::safer_string_typedef<std::string, log_line> {
+  using base = opaque::experimental::safer_string_typedef<std::string, log_line>;
+  using base::base;
+};
+
+// Split every line at the characters of set, with the typedef or std::string
+template <typename S>
+std::size_t tokens(const std::vector<S>& lines, const char * set) {
+  std::size_t count = 0;
+  for (const auto& line : lines) {
+    for (std::size_t p = 0; (p = line.find_first_of(set, p)) != S::npos; ++p) {
+      ++count;
+    }
+  }
+  return count;
+}
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 100000);
+  std::mt19937 rng(9);
+  std::vector<std::string> raw;
+  std::size_t bytes = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    // Key=value log fields with long unbroken values
+    std::string line = "2026-01-01T00:00:00Z level=info msg=";
+    const std::size_t len = 100 + rng() % 200;
+    for (std::size_t j = 0; j < len; ++j) line += char('a' + rng() % 26);
+    line += " service=gateway latency_ms=" + std::to_string(rng() % 1000);
+    bytes += line.size();
+    raw.push_back(line);
+  }
+  const std::vector<log_line> typed(raw.begin(), raw.end());
+
+  const char * small_set = " =\t;";
+  const char * large_set = " =\t;:,|[](){}<>\"'";
+  measure("std::string find_first_of, 4 bytes, per byte", bytes, [&] {
+    keep(tokens(raw, small_set));
+  });
+  measure("safer_string_typedef find_first_of, 4 bytes, per byte", bytes, [&] {
+    keep(tokens(typed, small_set));
+  });
+  measure("std::string find_first_of, 18 bytes, per byte", bytes, [&] {
+    keep(tokens(raw, large_set));
+  });
+  measure("safer_string_typedef find_first_of, 18 bytes, per byte", bytes, [&] {
+    keep(tokens(typed, large_set));
+  });
+  measure("std::string rfind(char), per byte", bytes, [&] {
+    std::size_t r = 0;
+    for (const auto& line : raw) r += line.rfind('T');
+    keep(r);
+  });
+  measure("safer_string_typedef rfind(char), per byte", bytes, [&] {
+    std::size_t r = 0;
+    for (const auto& line : typed) r += line.rfind('T');
+    keep(r);
+  });
+}
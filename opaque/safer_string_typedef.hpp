@@ -1,7 +1,7 @@
 #ifndef OPAQUE_EXPERIMENTAL_SAFER_STRING_TYPEDEF_HPP
 #define OPAQUE_EXPERIMENTAL_SAFER_STRING_TYPEDEF_HPP
 //
-// Copyright (c) 2016, 2021
+// Copyright (c) 2016, 2021, 2026
 // Kyle Markley.  All rights reserved.
 //
 // Redistribution and use in source and binary forms, with or without
@@ -29,8 +29,10 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 #include "opaque/storage.hpp"
+#include "opaque/simd.hpp"
 #include <memory>
 #include <string>
+#include <utility>
 
 namespace opaque {
 namespace experimental {
@@ -375,6 +377,15 @@ public:
     return value.get_allocator();
   }
 
+private:
+  //
+  // For strings of char with standard traits, the find_first_of family
+  // and rfind(charT) use the vectorized searches of detail, which run in
+  // O(n) however large the set; other strings use the members of S.
+  //
+  static constexpr bool byte_search = detail::byte_traits<traits_type>;
+public:
+
   size_type find (const opaque_type& str, size_type pos = 0) const noexcept {
     return value.find(str.value, pos);
   }
@@ -397,61 +408,82 @@ public:
     return value.rfind(s, pos);
   }
   size_type rfind(charT c, size_type pos = npos) const noexcept {
-    return value.rfind(c, pos);
+    return find_last_of(&c, pos, 1);
   }
 
   size_type find_first_of(const opaque_type& str, size_type pos = 0) const noexcept {
-    return value.find_first_of(str.value, pos);
+    return find_first_of(str.data(), pos, str.size());
   }
   size_type find_first_of(const charT* s, size_type pos, size_type n) const {
-    return value.find_first_of(s, pos, n);
+    if constexpr (byte_search) {
+      return detail::find_first_of(data(), size(), pos, s, n);
+    } else {
+      return value.find_first_of(s, pos, n);
+    }
   }
   size_type find_first_of(const charT* s, size_type pos = 0) const {
-    return value.find_first_of(s, pos);
+    return find_first_of(s, pos, traits_type::length(s));
   }
   size_type find_first_of(charT c, size_type pos = 0) const noexcept {
-    return value.find_first_of(c, pos);
+    return find_first_of(&c, pos, 1);
   }
   size_type find_last_of (const opaque_type& str, size_type pos = npos) const noexcept {
-    return value.find_last_of(str.value, pos);
+    return find_last_of(str.data(), pos, str.size());
   }
   size_type find_last_of (const charT* s, size_type pos, size_type n) const {
-    return value.find_last_of(s, pos, n);
+    if constexpr (byte_search) {
+      return detail::find_last_of(data(), size(), pos, s, n);
+    } else {
+      return value.find_last_of(s, pos, n);
+    }
   }
   size_type find_last_of (const charT* s, size_type pos = npos) const {
-    return value.find_last_of(s, pos);
+    return find_last_of(s, pos, traits_type::length(s));
   }
   size_type find_last_of (charT c, size_type pos = npos) const noexcept {
-    return value.find_last_of(c, pos);
+    return find_last_of(&c, pos, 1);
   }
 
   size_type find_first_not_of(const opaque_type& str, size_type pos = 0) const noexcept {
-    return value.find_first_not_of(str.value, pos);
+    return find_first_not_of(str.data(), pos, str.size());
   }
   size_type find_first_not_of(const charT* s, size_type pos, size_type n) const {
-    return value.find_first_not_of(s, pos, n);
+    if constexpr (byte_search) {
+      return detail::find_first_not_of(data(), size(), pos, s, n);
+    } else {
+      return value.find_first_not_of(s, pos, n);
+    }
   }
   size_type find_first_not_of(const charT* s, size_type pos = 0) const {
-    return value.find_first_not_of(s, pos);
+    return find_first_not_of(s, pos, traits_type::length(s));
   }
   size_type find_first_not_of(charT c, size_type pos = 0) const noexcept {
-    return value.find_first_not_of(c, pos);
+    return find_first_not_of(&c, pos, 1);
   }
   size_type find_last_not_of (const opaque_type& str, size_type pos = npos) const noexcept {
-    return value.find_last_not_of(str.value, pos);
+    return find_last_not_of(str.data(), pos, str.size());
   }
   size_type find_last_not_of (const charT* s, size_type pos, size_type n) const {
-    return value.find_last_not_of(s, pos, n);
+    if constexpr (byte_search) {
+      return detail::find_last_not_of(data(), size(), pos, s, n);
+    } else {
+      return value.find_last_not_of(s, pos, n);
+    }
   }
   size_type find_last_not_of (const charT* s, size_type pos = npos) const {
-    return value.find_last_not_of(s, pos);
+    return find_last_not_of(s, pos, traits_type::length(s));
   }
   size_type find_last_not_of (charT c, size_type pos = npos) const noexcept {
-    return value.find_last_not_of(c, pos);
+    return find_last_not_of(&c, pos, 1);
   }
 
+  //
+  // Results built from const operands use the allocator of the (left)
+  // operand rather than a copy-constructed one, so that strings with
+  // stateful allocators, such as std::pmr strings, keep their resource.
+  //
   opaque_type substr(size_type pos = 0, size_type n = npos) const {
-    return opaque_type(value.substr(pos, n));
+    return opaque_type(underlying_type(value, pos, n, value.get_allocator()));
   }
   int compare(const opaque_type& str) const noexcept {
     return value.compare(str.value);
@@ -475,15 +507,28 @@ public:
   }
 
   friend opaque_type operator+(const opaque_type&  l, const opaque_type&  r) {
-    return opaque_type(          l.value  +           r.value );
+    underlying_type s(l.value.get_allocator());
+    s.reserve(l.value.size() + r.value.size());
+    s.append(l.value).append(r.value);
+    return opaque_type(std::move(s));
   }
   friend opaque_type operator+(      opaque_type&& l, const opaque_type&  r) {
     return opaque_type(std::move(l.value) +           r.value );
   }
+  //
+  // Reusing the right operand's buffer would give the result its
+  // allocator, so that is done only when the allocators are equal.
+  //
   friend opaque_type operator+(const opaque_type&  l,       opaque_type&& r) {
+    if (l.value.get_allocator() != r.value.get_allocator()) {
+      return l + std::as_const(r);
+    }
     return opaque_type(          l.value  + std::move(r.value));
   }
   friend opaque_type operator+(      opaque_type&& l,       opaque_type&& r) {
+    if (l.value.get_allocator() != r.value.get_allocator()) {
+      return std::move(l) + std::as_const(r);
+    }
     return opaque_type(std::move(l.value) + std::move(r.value));
   }
   // friend opaque_type operator+(const charT* lhs, const opaque_type&  rhs);
@@ -28,6 +28,9 @@
 //
 #include "opaque/safer_string_typedef.hpp"
 #include "arrtest/arrtest.hpp"
+#include <random>
+#include <string>
+#include <type_traits>
 
 using namespace std;
 using namespace opaque;
@@ -58,4 +61,48 @@ SUITE(construction) {
     CHECK_EQUAL(a.value, empty);
     CHECK_EQUAL(b, c);
   }
+  // Moving transfers the buffer instead of copying it
+  static_assert(std::is_nothrow_move_constructible_v<a_string>);
+  static_assert(std::is_nothrow_move_assignable_v<a_string>);
+
+  TEST(move_steals_buffer) {
+    a_string a(std::string(100, 'x'));
+    const char * buffer = a.data();
+    a_string b(std::move(a));
+    CHECK(b.data() == buffer);
+    CHECK(a.empty());
+    a_string c;
+    c = std::move(b);
+    CHECK(c.data() == buffer);
+    CHECK(b.empty());
+  }
+}
+
+SUITE(search) {
+  // Every search agrees with std::string for every position and set size
+  TEST(matches_std_string) {
+    std::mt19937 rng(5);
+    std::string text;
+    for (int i = 0; i < 300; ++i) text += char('a' + rng() % 20);
+    const a_string s(text);
+    const std::string sets[] = { "", "q", "qk", "xyz", "aeiou", "lmnopqrs",
+      "abcdefghi", "abcdefghijklmnopqrs", "abcdefghijklmnopqrst" };
+    for (const auto& set : sets) {
+      for (std::size_t pos = 0; pos <= text.size() + 1; ++pos) {
+        CHECK_EQUAL(text.find_first_of(set, pos), s.find_first_of(set.c_str(), pos));
+        CHECK_EQUAL(text.find_last_of(set, pos), s.find_last_of(set.c_str(), pos));
+        CHECK_EQUAL(text.find_first_not_of(set, pos),
+                    s.find_first_not_of(set.c_str(), pos));
+        CHECK_EQUAL(text.find_last_not_of(set, pos),
+                    s.find_last_not_of(set.c_str(), pos));
+      }
+    }
+    for (std::size_t pos = 0; pos <= text.size(); pos += 7) {
+      CHECK_EQUAL(text.rfind('c', pos), s.rfind('c', pos));
+      CHECK_EQUAL(text.find_first_of('c', pos), s.find_first_of('c', pos));
+    }
+    CHECK_EQUAL(std::string::npos, a_string().find_last_of("abc"));
+    CHECK_EQUAL(std::string::npos, a_string().find_last_not_of(""));
+    CHECK_EQUAL(4u, a_string("aaaa=b").find_first_of(a_string("=;")));
+  }
 }
@@ -0,0 +1,96 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/shared_string_typedef.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <string>
+#include <vector>
+
+struct message : opaque::experimental::shared_string_typedef<message> {
+  using base = opaque::experimental::shared_string_typedef<message>;
+  using base::base;
+};
+
+struct message_text
+  : opaque::experimental::safer_string_typedef<std::string, message_text> {
+  using base =
+    opaque::experimental::safer_string_typedef<std::string, message_text>;
+  using base::base;
+};
+
+// Copy each message into every consumer queue, then drain the queues
+template <typename T>
+void fan_out(const std::vector<T>& messages,
+    std::vector<std::vector<T>>& queues) {
+  for (const auto& m : messages) {
+    for (auto& q : queues) q.push_back(m);
+  }
+  std::size_t total = 0;
+  for (auto& q : queues) {
+    for (const auto& m : q) total += m.size();
+    q.clear();
+  }
+  keep(total);
+}
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 2000);
+  constexpr std::size_t payload_bytes = 4096;
+
+  std::vector<message_text> texts;
+  std::vector<message> shared;
+  for (std::size_t i = 0; i < n; ++i) {
+    texts.emplace_back(std::string(payload_bytes, char('a' + i % 26)));
+    shared.emplace_back(texts.back());
+  }
+
+  for (std::size_t consumers : { 1u, 4u, 16u, 64u }) {
+    const std::string suffix = std::to_string(consumers) + " consumers, per copy";
+    std::vector<std::vector<message_text>> text_queues(consumers);
+    std::vector<std::vector<message>> shared_queues(consumers);
+    for (auto& q : text_queues) q.reserve(n);
+    for (auto& q : shared_queues) q.reserve(n);
+    measure(("safer_string_typedef fan-out, " + suffix).c_str(), n * consumers, [&] {
+      fan_out(texts, text_queues);
+    });
+    measure(("shared_string_typedef fan-out, " + suffix).c_str(), n * consumers, [&] {
+      fan_out(shared, shared_queues);
+    });
+  }
+
+  measure("safer_string_typedef substr", n, [&] {
+    std::size_t total = 0;
+    for (const auto& t : texts) total += t.substr(100, 2000).size();
+    keep(total);
+  });
+  measure("shared_string_typedef substr", n, [&] {
+    std::size_t total = 0;
+    for (const auto& m : shared) total += m.substr(100, 2000).size();
+    keep(total);
+  });
+}
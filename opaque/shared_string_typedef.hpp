@@ -0,0 +1,284 @@
+#ifndef OPAQUE_SHARED_STRING_TYPEDEF_HPP
+#define OPAQUE_SHARED_STRING_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/storage.hpp"
+#include "opaque/safer_string_typedef.hpp"
+#include <algorithm>
+#include <atomic>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Immutable string sharing one reference-counted buffer among its copies
+///
+/// The count, the length and the characters are one allocation.  Copying
+/// increments the count atomically, so copies may be handed to and dropped
+/// by other threads; substr shares the buffer too and only narrows the
+/// range seen, so it is O(1).  The buffer is freed with its last reference.
+///
+/// Because a substring may end before the buffer does, data() is not
+/// null-terminated in general; use view() or convert to a std::string.
+///
+template <typename CharT = char, typename Traits = std::char_traits<CharT>>
+class shared_string {
+public:
+  using value_type     = CharT;
+  using traits_type    = Traits;
+  using size_type      = std::size_t;
+  using view_type      = std::basic_string_view<CharT, Traits>;
+  using const_iterator = typename view_type::const_iterator;
+  static constexpr size_type npos = view_type::npos;
+
+  shared_string() noexcept = default;
+
+  /// Copy s into a new buffer; the empty string allocates nothing
+  explicit shared_string(view_type s) {
+    if (s.empty()) return;
+    block_ = allocate(s.size());
+    CharT * d = chars(block_);
+    Traits::copy(d, s.data(), s.size());
+    d[s.size()] = CharT();
+    data_ = d;
+    size_ = s.size();
+  }
+
+  shared_string(const shared_string& o) noexcept
+    : block_(o.block_), data_(o.data_), size_(o.size_) {
+    if (block_) block_->refs.fetch_add(1, std::memory_order_relaxed);
+  }
+  shared_string(shared_string&& o) noexcept
+    : block_(std::exchange(o.block_, nullptr))
+    , data_(std::exchange(o.data_, nullptr))
+    , size_(std::exchange(o.size_, 0)) { }
+
+  shared_string& operator=(shared_string o) & noexcept {
+    swap(o);
+    return *this;
+  }
+
+  ~shared_string() { release(); }
+
+  void swap(shared_string& o) noexcept {
+    std::swap(block_, o.block_);
+    std::swap(data_, o.data_);
+    std::swap(size_, o.size_);
+  }
+
+  size_type  size() const noexcept { return size_; }
+  bool      empty() const noexcept { return size_ == 0; }
+  const CharT * data() const noexcept { return data_; }
+  view_type  view() const noexcept { return view_type(data_, size_); }
+
+  const_iterator begin() const noexcept { return view().begin(); }
+  const_iterator   end() const noexcept { return view().end();   }
+
+  const CharT& operator[](size_type pos) const noexcept { return data_[pos]; }
+  const CharT& at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("opaque::shared_string::at");
+    return data_[pos];
+  }
+  const CharT& front() const noexcept { return data_[0]; }
+  const CharT&  back() const noexcept { return data_[size_ - 1]; }
+
+  /// The characters [pos, pos + n), sharing this string's buffer
+  shared_string substr(size_type pos = 0, size_type n = npos) const {
+    if (pos > size_) throw std::out_of_range("opaque::shared_string::substr");
+    n = std::min(n, size_ - pos);
+    if (n == 0) return shared_string();
+    shared_string r(*this);
+    r.data_ += pos;
+    r.size_ = n;
+    return r;
+  }
+
+  /// Number of shared_string instances sharing the buffer; 0 when empty
+  size_type use_count() const noexcept {
+    return block_ ? block_->refs.load(std::memory_order_relaxed) : 0;
+  }
+
+  int compare(const shared_string& o) const noexcept {
+    return view().compare(o.view());
+  }
+
+  friend bool operator==(const shared_string& a, const shared_string& b)
+    noexcept {
+    return a.size_ == b.size_ and
+      (a.data_ == b.data_ or Traits::compare(a.data_, b.data_, a.size_) == 0);
+  }
+  friend auto operator<=>(const shared_string& a, const shared_string& b)
+    noexcept {
+    return a.view() <=> b.view();
+  }
+
+private:
+  struct header {
+    std::atomic<size_type> refs;
+    size_type capacity;
+  };
+  static_assert(alignof(CharT) <= alignof(header));
+
+  static header * allocate(size_type n) {
+    void * p = ::operator new(sizeof(header) + (n + 1) * sizeof(CharT));
+    return ::new (p) header{ {1}, n };
+  }
+
+  static CharT * chars(header * h) noexcept {
+    return static_cast<CharT *>(static_cast<void *>(h + 1));
+  }
+
+  void release() noexcept {
+    if (block_ and block_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      block_->~header();
+      ::operator delete(static_cast<void *>(block_));
+    }
+  }
+
+  header * block_ = nullptr;
+  const CharT * data_ = nullptr;
+  size_type size_ = 0;
+};
+
+/// @}
+
+namespace experimental {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Immutable string typedef whose copies share one buffer
+///
+/// Suited to large payloads that are copied into many places, such as a
+/// message fanned out to many queues: a copy costs one atomic increment
+/// instead of an allocation and a copy of every character, and substr is
+/// O(1).  There are no mutating members; conversion to a
+/// safer_string_typedef instance is explicit and copies the text, giving
+/// a mutable string again.
+///
+/// Template arguments:
+///  -# O : The result type, your subclass
+///  -# CharT : The character type
+///  -# Traits : The character traits type
+///
+template <typename O, typename CharT = char,
+         typename Traits = std::char_traits<CharT>>
+struct shared_string_typedef
+  : opaque_storage<opaque::shared_string<CharT, Traits>, O> {
+private:
+  using base = opaque_storage<opaque::shared_string<CharT, Traits>, O>;
+public:
+  using underlying_type = opaque::shared_string<CharT, Traits>;
+  using     opaque_type = O;
+  using base::value;
+
+  using traits_type    = Traits;
+  using value_type     = CharT;
+  using size_type      = std::size_t;
+  using view_type      = std::basic_string_view<CharT, Traits>;
+  using const_iterator = typename view_type::const_iterator;
+  static constexpr size_type npos = underlying_type::npos;
+
+  shared_string_typedef() = default;
+
+  explicit shared_string_typedef(view_type s) : base(s) { }
+
+  explicit shared_string_typedef(const CharT * s)
+    : shared_string_typedef(view_type(s)) { }
+
+  template <typename S, typename R>
+    requires std::same_as<typename S::value_type, CharT>
+  explicit shared_string_typedef(const safer_string_typedef<S,R>& s)
+    : shared_string_typedef(view_type(s.value.data(), s.value.size())) { }
+
+  /// Copy the text into a safer_string_typedef
+  template <typename R>
+    requires std::derived_from<R,
+      safer_string_typedef<typename R::underlying_type, R>>
+  explicit operator R() const {
+    return R(typename R::underlying_type(view()));
+  }
+
+  size_type      size() const noexcept { return value.size(); }
+  bool          empty() const noexcept { return value.empty(); }
+  const CharT *  data() const noexcept { return value.data(); }
+  view_type      view() const noexcept { return value.view(); }
+
+  const_iterator begin() const noexcept { return value.begin(); }
+  const_iterator   end() const noexcept { return value.end();   }
+
+  const CharT& operator[](size_type pos) const noexcept { return value[pos]; }
+  const CharT& at(size_type pos) const { return value.at(pos); }
+  const CharT& front() const noexcept { return value.front(); }
+  const CharT&  back() const noexcept { return value.back(); }
+
+  /// The characters [pos, pos + n), sharing this instance's buffer
+  opaque_type substr(size_type pos = 0, size_type n = npos) const {
+    opaque_type r;
+    r.value = value.substr(pos, n);
+    return r;
+  }
+
+  int compare(const opaque_type& s) const noexcept {
+    return value.compare(s.value);
+  }
+
+  size_type use_count() const noexcept { return value.use_count(); }
+};
+
+/// @}
+
+}
+}
+
+///
+/// Hash a shared_string as std::hash hashes the equal std::basic_string_view
+///
+template <typename CharT, typename Traits>
+struct std::hash<opaque::shared_string<CharT, Traits>> {
+  using argument_type = opaque::shared_string<CharT, Traits>;
+  using result_type = std::size_t;
+  result_type operator()(const argument_type& s) const noexcept {
+    return std::hash<std::basic_string_view<CharT, Traits>>{}(s.view());
+  }
+};
+
+#endif
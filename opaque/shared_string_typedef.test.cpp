@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/shared_string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "arrtest/arrtest.hpp"
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+struct payload : opaque::experimental::shared_string_typedef<payload> {
+  using base = opaque::experimental::shared_string_typedef<payload>;
+  using base::base;
+};
+
+struct header : opaque::experimental::shared_string_typedef<header> {
+  using base = opaque::experimental::shared_string_typedef<header>;
+  using base::base;
+};
+
+struct body : opaque::experimental::safer_string_typedef<std::string, body> {
+  using base = opaque::experimental::safer_string_typedef<std::string, body>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(payload)
+
+static_assert(sizeof(payload) == 3 * sizeof(void *));
+static_assert(std::is_nothrow_copy_constructible_v<payload>);
+static_assert(not std::is_convertible_v<const char *, payload>);
+static_assert(not std::is_convertible_v<std::string, payload>);
+static_assert(not std::is_convertible_v<body, payload>);
+static_assert(not std::is_convertible_v<payload, body>);
+static_assert(not std::is_constructible_v<payload, header>);
+static_assert(std::is_constructible_v<payload, body>);
+static_assert(std::is_constructible_v<body, payload>);
+
+TEST(construction) {
+  const payload a("event:login"), b(std::string("event:login"));
+  const payload c(std::string_view("event:logout")), d;
+  CHECK(a == b);
+  CHECK(a != c);
+  CHECK(a < c);
+  CHECK(a.view() == "event:login");
+  CHECK_EQUAL(11u, a.size());
+  CHECK_EQUAL('e', a.front());
+  CHECK_EQUAL('n', a.back());
+  CHECK_EQUAL(':', a[5]);
+  CHECK(std::string(c.begin(), c.end()) == "event:logout");
+  CHECK(d.empty());
+  CHECK_EQUAL(0u, d.use_count());
+  CHECK(d == payload(""));
+  try { a.at(11); CHECK(false); } catch (const std::out_of_range& e) { }
+}
+
+TEST(copies_share) {
+  const payload a("a payload too large to copy cheaply");
+  CHECK_EQUAL(1u, a.use_count());
+  {
+    std::vector<payload> queue(10, a);
+    CHECK_EQUAL(11u, a.use_count());
+    CHECK(queue[3].data() == a.data());
+    payload moved = std::move(queue[3]);
+    CHECK_EQUAL(11u, a.use_count());
+    CHECK(queue[3].empty());
+    moved = payload("other");
+    CHECK_EQUAL(10u, a.use_count());
+  }
+  CHECK_EQUAL(1u, a.use_count());
+}
+
+TEST(substr) {
+  const payload a("key=value;other=thing");
+  const payload v = a.substr(4, 5);
+  CHECK(v.view() == "value");
+  CHECK(v.data() == a.data() + 4);
+  CHECK_EQUAL(2u, a.use_count());
+  CHECK(v == payload("value"));
+  CHECK(a.substr(10).view() == "other=thing");
+  CHECK(a.substr(21).empty());
+  CHECK(v.substr(1, 100).view() == "alue");
+  try { a.substr(22); CHECK(false); } catch (const std::out_of_range& e) { }
+}
+
+TEST(conversion) {
+  const body m("mutable text");
+  const payload p(m);
+  body back(p);
+  CHECK(back == m);
+  back.push_back('!');
+  CHECK(p.view() == "mutable text");
+}
+
+TEST(hash) {
+  std::unordered_set<payload> seen;
+  const payload a("abcdef");
+  seen.insert(a);
+  seen.insert(a.substr(0, 3));
+  seen.insert(payload("abc"));
+  CHECK_EQUAL(2u, seen.size());
+  CHECK_EQUAL(std::hash<std::string_view>{}("abc"),
+              std::hash<payload>{}(a.substr(0, 3)));
+}
+
+TEST(threads) {
+  const payload a(std::string(1000, 'x'));
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 10000; ++i) {
+        const payload copy = a;
+        const payload part = copy.substr(static_cast<std::size_t>(i % 100));
+        if (part.size() + static_cast<std::size_t>(i % 100) != 1000) return;
+      }
+    });
+  }
+  for (auto& t : threads) t.join();
+  CHECK_EQUAL(1u, a.use_count());
+}
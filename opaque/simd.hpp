@@ -0,0 +1,422 @@
+#ifndef OPAQUE_SIMD_HPP
+#define OPAQUE_SIMD_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+//
+// Vector helpers shared by the containers and bulk algorithms.
+//
+// Only SSE2 is assumed on x86, because it is part of the x86-64 baseline and
+// needs no special compiler flags.  Every vector path has a portable
+// word-at-a-time fallback with identical results.
+//
+
+namespace detail {
+
+///
+/// Set of matching lanes, iterated from the lowest lane upward
+///
+/// Each lane occupies (1 << shift) bits of the mask, of which only the
+/// highest bit may be set.
+///
+template <unsigned shift>
+struct lane_mask {
+  std::uint64_t mask;
+
+  constexpr explicit operator bool() const noexcept { return mask != 0; }
+
+  constexpr unsigned lowest() const noexcept {
+    return static_cast<unsigned>(std::countr_zero(mask)) >> shift;
+  }
+
+  constexpr lane_mask& operator++() noexcept {
+    mask &= mask - 1;
+    return *this;
+  }
+};
+
+//
+// Control bytes for open-addressing tables
+//
+// A control byte is either empty, deleted (a tombstone), or full, in which
+// case it holds seven bits of the hash.  Empty and deleted have the high bit
+// set, so full slots are distinguished by a nonnegative value.
+//
+enum class ctrl : std::int8_t { empty = -128, deleted = -2 };
+
+constexpr bool is_full(std::int8_t c) noexcept { return c >= 0; }
+
+#if defined(__SSE2__)
+
+///
+/// A group of sixteen control bytes probed with SSE2
+///
+struct ctrl_group {
+  static constexpr unsigned width = 16;
+  using mask_type = lane_mask<0>;
+
+  explicit ctrl_group(const std::int8_t * pos) noexcept
+    : bytes(_mm_loadu_si128(static_cast<const __m128i *>(
+            static_cast<const void *>(pos)))) { }
+
+  mask_type match(std::int8_t h2) const noexcept {
+    return bitmask(_mm_cmpeq_epi8(_mm_set1_epi8(h2), bytes));
+  }
+
+  mask_type match_empty() const noexcept {
+    return bitmask(_mm_cmpeq_epi8(
+          _mm_set1_epi8(static_cast<std::int8_t>(ctrl::empty)), bytes));
+  }
+
+  mask_type match_empty_or_deleted() const noexcept {
+    return bitmask(bytes);
+  }
+
+private:
+  static mask_type bitmask(__m128i v) noexcept {
+    return mask_type{static_cast<std::uint16_t>(_mm_movemask_epi8(v))};
+  }
+
+  __m128i bytes;
+};
+
+#else
+
+///
+/// A group of eight control bytes probed with 64-bit word operations
+///
+/// match() may report a false positive for a byte following a true match;
+/// callers compare the key anyway, so this costs only a rare extra compare.
+///
+struct ctrl_group {
+  static constexpr unsigned width = 8;
+  using mask_type = lane_mask<3>;
+
+  // Assembled explicitly so that lane i is byte i on any endianness.
+  explicit ctrl_group(const std::int8_t * pos) noexcept : bytes(0) {
+    for (unsigned i = 0; i < width; ++i) {
+      bytes |= std::uint64_t{static_cast<std::uint8_t>(pos[i])} << (8 * i);
+    }
+  }
+
+  mask_type match(std::int8_t h2) const noexcept {
+    const std::uint64_t x = bytes ^ (lsbs * static_cast<std::uint8_t>(h2));
+    return mask_type{(x - lsbs) & ~x & msbs};
+  }
+
+  mask_type match_empty() const noexcept {
+    return mask_type{bytes & ~(bytes << 6) & msbs};
+  }
+
+  mask_type match_empty_or_deleted() const noexcept {
+    return mask_type{bytes & msbs};
+  }
+
+private:
+  static constexpr std::uint64_t lsbs = 0x0101010101010101u;
+  static constexpr std::uint64_t msbs = 0x8080808080808080u;
+
+  std::uint64_t bytes;
+};
+
+#endif
+
+//
+// Bulk comparison of unsigned words
+//
+
+#if defined(__SSE2__)
+
+template <typename T>
+inline __m128i splat(T x) noexcept {
+  if constexpr (sizeof(T) == 1) return _mm_set1_epi8 (static_cast<char     >(x));
+  if constexpr (sizeof(T) == 2) return _mm_set1_epi16(static_cast<short    >(x));
+  if constexpr (sizeof(T) == 4) return _mm_set1_epi32(static_cast<int      >(x));
+  if constexpr (sizeof(T) == 8) return _mm_set1_epi64x(static_cast<long long>(x));
+}
+
+/// One bit per lane of T, set where the lanes of a and b are equal
+template <typename T>
+inline unsigned lanes_equal(__m128i a, __m128i b) noexcept {
+  if constexpr (sizeof(T) == 1) {
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b)));
+  } else if constexpr (sizeof(T) == 2) {
+    const __m128i eq = _mm_cmpeq_epi16(a, b);
+    return static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_packs_epi16(eq, _mm_setzero_si128())));
+  } else if constexpr (sizeof(T) == 4) {
+    return static_cast<unsigned>(
+        _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(a, b))));
+  } else {
+    // No 64-bit compare in SSE2: both 32-bit halves must be equal
+    const __m128i eq = _mm_cmpeq_epi32(a, b);
+    const __m128i both = _mm_and_si128(eq,
+        _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+    return static_cast<unsigned>(_mm_movemask_pd(_mm_castsi128_pd(both)));
+  }
+}
+
+#endif
+
+///
+/// Compare 64 consecutive unsigned words at p (which need not be aligned)
+///
+/// Bit i of the result is set when (p[i] & mask) == want.
+///
+template <typename T>
+inline std::uint64_t masked_equal_64(const void * p, T mask, T want) noexcept {
+  static_assert(std::is_unsigned_v<T> and sizeof(T) <= 8);
+  const auto * bytes = static_cast<const unsigned char *>(p);
+  std::uint64_t r = 0;
+#if defined(__SSE2__)
+  constexpr unsigned lanes = 16 / sizeof(T);
+  const __m128i m = splat(mask);
+  const __m128i w = splat(want);
+  for (unsigned i = 0; i < 64 / lanes; ++i) {
+    const __m128i v = _mm_and_si128(m, _mm_loadu_si128(
+          static_cast<const __m128i *>(static_cast<const void *>(bytes))));
+    r |= std::uint64_t{lanes_equal<T>(v, w)} << (i * lanes);
+    bytes += 16;
+  }
+#else
+  for (unsigned i = 0; i < 64; ++i) {
+    T x;
+    std::memcpy(&x, bytes + i * sizeof(T), sizeof(T));
+    r |= std::uint64_t{(x & mask) == want} << i;
+  }
+#endif
+  return r;
+}
+
+///
+/// Pack 64 flag bytes (each 0 or 1) into a 64-bit mask, byte i to bit i
+///
+/// Bulk predicates compute a byte per element in loops the compiler
+/// vectorizes, then pack them with this.
+///
+inline std::uint64_t pack_flags_64(const std::uint8_t * flags) noexcept {
+  std::uint64_t r = 0;
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  for (unsigned i = 0; i < 4; ++i) {
+    const __m128i v = _mm_loadu_si128(static_cast<const __m128i *>(
+          static_cast<const void *>(flags + 16 * i)));
+    // 0 - 1 sets the high bit of each flagged byte
+    const auto m = static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_sub_epi8(zero, v)));
+    r |= std::uint64_t{m} << (16 * i);
+  }
+#else
+  for (unsigned i = 0; i < 64; ++i) r |= std::uint64_t{flags[i]} << i;
+#endif
+  return r;
+}
+
+//
+// Scanning text for separators
+//
+
+///
+/// Call f with a pointer to each occurrence of a or b in [first, last)
+///
+/// Sixteen bytes are compared per step with SSE2.  f returns false to stop.
+///
+template <typename F>
+inline void for_each_either(const char * first, const char * last,
+    char a, char b, F&& f) {
+  const char * p = first;
+#if defined(__SSE2__)
+  const __m128i va = _mm_set1_epi8(a);
+  const __m128i vb = _mm_set1_epi8(b);
+  for (; last - p >= 16; p += 16) {
+    const __m128i v = _mm_loadu_si128(
+        static_cast<const __m128i *>(static_cast<const void *>(p)));
+    auto m = static_cast<unsigned>(_mm_movemask_epi8(
+          _mm_or_si128(_mm_cmpeq_epi8(v, va), _mm_cmpeq_epi8(v, vb))));
+    for (; m; m &= m - 1) {
+      if (not f(p + std::countr_zero(m))) return;
+    }
+  }
+#endif
+  for (; p != last; ++p) {
+    if ((*p == a or *p == b) and not f(p)) return;
+  }
+}
+
+//
+// Searching strings for sets of bytes
+//
+// These implement the find_first_of family for strings of char with the
+// semantics of std::basic_string, but in O(n) rather than O(n * m): sets
+// of up to eight bytes are matched sixteen positions at a time with SSE2,
+// and larger sets through a 256-bit membership table.
+//
+
+/// Strings whose comparisons are plain byte comparisons
+template <typename Traits>
+concept byte_traits = std::is_same_v<Traits, std::char_traits<char>>;
+
+inline constexpr std::size_t no_position = std::size_t(-1);
+
+class byte_set {
+public:
+  byte_set(const char * s, std::size_t m) noexcept
+    : count(static_cast<unsigned>(std::min<std::size_t>(m, 9))) {
+    for (std::size_t i = 0; i < m; ++i) {
+      const auto c = static_cast<unsigned char>(s[i]);
+      bits[c >> 6] |= std::uint64_t{1} << (c & 63);
+    }
+#if defined(__SSE2__)
+    if (vectorized()) {
+      for (unsigned i = 0; i < count; ++i) splats[i] = _mm_set1_epi8(s[i]);
+    }
+#endif
+  }
+
+  bool contains(char c) const noexcept {
+    const auto u = static_cast<unsigned char>(c);
+    return (bits[u >> 6] >> (u & 63)) & 1;
+  }
+
+#if defined(__SSE2__)
+  bool vectorized() const noexcept { return count <= 8; }
+
+  /// One bit per byte of the sixteen at p, set for members
+  unsigned match16(const char * p) const noexcept {
+    const __m128i v = _mm_loadu_si128(
+        static_cast<const __m128i *>(static_cast<const void *>(p)));
+    __m128i m = _mm_cmpeq_epi8(v, splats[0]);
+    for (unsigned i = 1; i < count; ++i) {
+      m = _mm_or_si128(m, _mm_cmpeq_epi8(v, splats[i]));
+    }
+    return static_cast<unsigned>(_mm_movemask_epi8(m));
+  }
+#endif
+
+private:
+  std::uint64_t bits[4] = {};
+  unsigned count;
+#if defined(__SSE2__)
+  __m128i splats[8];
+#endif
+};
+
+/// First index from pos whose membership in set differs from Negate
+template <bool Negate>
+inline std::size_t scan_forward(const char * p, std::size_t n,
+    std::size_t pos, const byte_set& set) noexcept {
+  std::size_t i = pos;
+#if defined(__SSE2__)
+  if (set.vectorized()) {
+    for (; n - i >= 16; i += 16) {
+      unsigned m = set.match16(p + i);
+      if (Negate) m ^= 0xffffu;
+      if (m) return i + static_cast<std::size_t>(std::countr_zero(m));
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    if (set.contains(p[i]) != Negate) return i;
+  }
+  return no_position;
+}
+
+/// Last index at or before pos whose membership in set differs from Negate
+template <bool Negate>
+inline std::size_t scan_backward(const char * p, std::size_t n,
+    std::size_t pos, const byte_set& set) noexcept {
+  std::size_t len = std::min(pos, n - 1) + 1;
+#if defined(__SSE2__)
+  if (set.vectorized()) {
+    for (; len >= 16; len -= 16) {
+      unsigned m = set.match16(p + len - 16);
+      if (Negate) m ^= 0xffffu;
+      if (m) return len - 17 + static_cast<std::size_t>(std::bit_width(m));
+    }
+  }
+#endif
+  while (len-- > 0) {
+    if (set.contains(p[len]) != Negate) return len;
+  }
+  return no_position;
+}
+
+inline std::size_t find_first_of(const char * p, std::size_t n,
+    std::size_t pos, const char * s, std::size_t m) noexcept {
+  if (pos >= n or m == 0) return no_position;
+  if (m == 1) {
+    const void * r = std::memchr(p + pos, s[0], n - pos);
+    return r ? static_cast<std::size_t>(static_cast<const char *>(r) - p)
+             : no_position;
+  }
+  return scan_forward<false>(p, n, pos, byte_set(s, m));
+}
+
+inline std::size_t find_first_not_of(const char * p, std::size_t n,
+    std::size_t pos, const char * s, std::size_t m) noexcept {
+  if (pos >= n) return no_position;
+  if (m == 0) return pos;
+  return scan_forward<true>(p, n, pos, byte_set(s, m));
+}
+
+inline std::size_t find_last_of(const char * p, std::size_t n,
+    std::size_t pos, const char * s, std::size_t m) noexcept {
+  if (n == 0 or m == 0) return no_position;
+  return scan_backward<false>(p, n, pos, byte_set(s, m));
+}
+
+inline std::size_t find_last_not_of(const char * p, std::size_t n,
+    std::size_t pos, const char * s, std::size_t m) noexcept {
+  if (n == 0) return no_position;
+  if (m == 0) return std::min(pos, n - 1);
+  return scan_backward<true>(p, n, pos, byte_set(s, m));
+}
+
+}
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,644 @@
+#ifndef OPAQUE_SMALL_STRING_HPP
+#define OPAQUE_SMALL_STRING_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// String with inline storage for short values
+///
+/// The characters of a string of up to inline_capacity characters live
+/// inside the object, which is only as large as that capacity plus one
+/// byte.  With Spill, longer strings move to the heap, and the object is at
+/// least 16 bytes (pointer, size, capacity); without it, they throw
+/// std::length_error and the type is trivially copyable.
+///
+/// inline_capacity is N rounded up to fill the alignment padding.  The last
+/// byte holds inline_capacity - size(), which is zero, and so doubles as
+/// the terminator, when the buffer is full.  Unused inline bytes are kept
+/// zero, so two inline strings are equal exactly when their bytes are,
+/// which compares a word at a time.
+///
+/// The interface follows std::string, so that small_string can serve as
+/// the underlying type of a safer_string_typedef.
+///
+/// Template arguments:
+///  -# N : The minimum number of characters stored inline
+///  -# Spill : Whether longer strings move to the heap
+///
+template <std::size_t N, bool Spill = true>
+class small_string {
+  static constexpr std::size_t bytes =
+    Spill ? std::max<std::size_t>((N + 8) / 8 * 8, 16) : N + 1;
+  static_assert(N > 0 and bytes <= 255,
+      "small_string inline capacity must be between 1 and 254");
+
+  // Heap representation: pointer, 32-bit size, log2 of the allocation
+  static constexpr std::size_t size_offset = sizeof(char *);
+  static constexpr std::size_t log_offset = size_offset + 4;
+  static constexpr char spilled_tag = char(-1);
+
+public:
+  using traits_type            = std::char_traits<char>;
+  using value_type             = char;
+  using allocator_type         = std::allocator<char>;
+  using size_type              = std::size_t;
+  using difference_type        = std::ptrdiff_t;
+  using reference              = char&;
+  using const_reference        = const char&;
+  using pointer                = char *;
+  using const_pointer          = const char *;
+  using iterator               = char *;
+  using const_iterator         = const char *;
+  using reverse_iterator       = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+  using view_type              = std::string_view;
+
+  static constexpr size_type npos = size_type(-1);
+  static constexpr size_type inline_capacity = bytes - 1;
+
+  //
+  // Construction, mirroring std::string.  Allocator arguments are accepted
+  // for compatibility and ignored; spilled strings use operator new[].
+  //
+
+  small_string() noexcept { set_inline_size(0); }
+  explicit small_string(const allocator_type&) noexcept : small_string() { }
+
+  small_string(const char * s, const allocator_type& = allocator_type())
+    : small_string() { append(s); }
+  small_string(const char * s, size_type n,
+      const allocator_type& = allocator_type())
+    : small_string() { append(s, n); }
+  small_string(size_type n, char c, const allocator_type& = allocator_type())
+    : small_string() { append(n, c); }
+  template <std::input_iterator It>
+  small_string(It first, It last, const allocator_type& = allocator_type())
+    : small_string() { append(first, last); }
+  small_string(std::initializer_list<char> il,
+      const allocator_type& = allocator_type())
+    : small_string() { append(il); }
+  explicit small_string(view_type s, const allocator_type& = allocator_type())
+    : small_string() { append(s); }
+  small_string(const small_string& s, size_type pos, size_type n = npos,
+      const allocator_type& = allocator_type())
+    : small_string() { append(s, pos, n); }
+  small_string(const small_string& s, const allocator_type&)
+    : small_string(s) { }
+
+  small_string(const small_string&) requires (not Spill) = default;
+  small_string(small_string&&) requires (not Spill) = default;
+  small_string& operator=(const small_string&) requires (not Spill) = default;
+  small_string& operator=(small_string&&) requires (not Spill) = default;
+  ~small_string() requires (not Spill) = default;
+
+  small_string(const small_string& s) requires Spill {
+    if (s.spilled()) {
+      set_inline_size(0);
+      append(s.data(), s.size());
+    } else {
+      std::memcpy(buf_, s.buf_, bytes);
+    }
+  }
+  small_string(small_string&& s) noexcept requires Spill {
+    std::memcpy(buf_, s.buf_, bytes);
+    s.reset();
+  }
+  small_string& operator=(const small_string& s) requires Spill {
+    return assign(s.data(), s.size());
+  }
+  small_string& operator=(small_string&& s) noexcept requires Spill {
+    if (this != &s) {
+      release();
+      std::memcpy(buf_, s.buf_, bytes);
+      s.reset();
+    }
+    return *this;
+  }
+  ~small_string() requires Spill { release(); }
+
+  small_string& operator=(view_type s) { return assign(s); }
+  small_string& operator=(const char * s) { return assign(s); }
+  small_string& operator=(char c) { return assign(1, c); }
+  small_string& operator=(std::initializer_list<char> il) {
+    return assign(il);
+  }
+
+  operator view_type() const noexcept { return view_type(data(), size()); }
+
+  //
+  // Iterators and capacity
+  //
+
+  iterator                 begin()       noexcept { return data();          }
+  const_iterator           begin() const noexcept { return data();          }
+  iterator                   end()       noexcept { return data() + size(); }
+  const_iterator             end() const noexcept { return data() + size(); }
+  reverse_iterator        rbegin()       noexcept { return reverse_iterator(end()); }
+  const_reverse_iterator  rbegin() const noexcept { return const_reverse_iterator(end()); }
+  reverse_iterator          rend()       noexcept { return reverse_iterator(begin()); }
+  const_reverse_iterator    rend() const noexcept { return const_reverse_iterator(begin()); }
+  const_iterator          cbegin() const noexcept { return begin();  }
+  const_iterator            cend() const noexcept { return end();    }
+  const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+  const_reverse_iterator   crend() const noexcept { return rend();   }
+
+  size_type size() const noexcept {
+    if (spilled()) return load<std::uint32_t>(size_offset);
+    return inline_capacity - static_cast<unsigned char>(buf_[inline_capacity]);
+  }
+  size_type   length() const noexcept { return size(); }
+  size_type max_size() const noexcept {
+    return Spill ? UINT32_MAX - 1 : inline_capacity;
+  }
+  size_type capacity() const noexcept {
+    return spilled() ? heap_capacity() - 1 : inline_capacity;
+  }
+  bool empty() const noexcept { return size() == 0; }
+
+  /// Whether the characters are on the heap
+  bool spilled() const noexcept {
+    if constexpr (Spill) return buf_[inline_capacity] == spilled_tag;
+    return false;
+  }
+
+  void reserve(size_type n) {
+    if (n > capacity()) reallocate(n);
+  }
+
+  void shrink_to_fit() {
+    if (spilled() and size() <= inline_capacity) {
+      small_string s(data(), size());
+      *this = std::move(s);
+    }
+  }
+
+  void resize(size_type n, char c) {
+    if (n <= size()) erase(n);
+    else append(n - size(), c);
+  }
+  void resize(size_type n) { resize(n, char()); }
+  void clear() noexcept { erase(begin(), end()); }
+
+  //
+  // Element access
+  //
+
+  const_reference operator[](size_type pos) const { return data()[pos]; }
+        reference operator[](size_type pos)       { return data()[pos]; }
+  const_reference at(size_type pos) const { return data()[check(pos)]; }
+        reference at(size_type pos)       { return data()[check(pos)]; }
+  const char& front() const { return data()[0]; }
+        char& front()       { return data()[0]; }
+  const char& back()  const { return data()[size() - 1]; }
+        char& back()        { return data()[size() - 1]; }
+
+  const char * data()  const noexcept {
+    return spilled() ? load<char *>(0) : buf_;
+  }
+        char * data()        noexcept {
+    return spilled() ? load<char *>(0) : buf_;
+  }
+  const char * c_str() const noexcept { return data(); }
+
+  allocator_type get_allocator() const noexcept { return allocator_type(); }
+
+  //
+  // Modifiers, all in terms of replace(pos, n1, s, n2)
+  //
+
+  small_string& replace(size_type pos, size_type n1, const char * s,
+      size_type n2) {
+    const size_type n = size();
+    if (pos > n) throw std::out_of_range("opaque::small_string");
+    n1 = std::min(n1, n - pos);
+    const size_type m = n - n1 + n2;
+    if (m > max_size()) throw std::length_error("opaque::small_string");
+
+    if (pos == n and m <= capacity()) {
+      // Appending in place; the source may lie within this string
+      char * d = data();
+      std::memmove(d + n, s, n2);
+      set_size(m);
+      return *this;
+    }
+
+    // Build the result separately, as s may lie within this string
+    const char * old = data();
+    if (m <= inline_capacity) {
+      char tmp[bytes] = {};
+      std::memcpy(tmp, old, pos);
+      std::memcpy(tmp + pos, s, n2);
+      std::memcpy(tmp + pos + n2, old + pos + n1, n - pos - n1);
+      release();
+      std::memcpy(buf_, tmp, inline_capacity);
+      set_inline_size(m);
+    } else {
+      const unsigned lg = log_capacity_for(m);
+      char * p = new char[std::size_t{1} << lg];
+      std::memcpy(p, old, pos);
+      std::memcpy(p + pos, s, n2);
+      std::memcpy(p + pos + n2, old + pos + n1, n - pos - n1);
+      release();
+      set_heap(p, m, lg);
+    }
+    return *this;
+  }
+  small_string& replace(size_type pos, size_type n1, view_type s) {
+    return replace(pos, n1, s.data(), s.size());
+  }
+  small_string& replace(size_type pos1, size_type n1, const small_string& s,
+      size_type pos2, size_type n2 = npos) {
+    return replace(pos1, n1, view_type(s).substr(pos2, n2));
+  }
+  small_string& replace(size_type pos, size_type n1, size_type n2, char c) {
+    return replace(pos, n1, small_string(n2, c));
+  }
+  small_string& replace(const_iterator i1, const_iterator i2, view_type s) {
+    return replace(offset(i1), static_cast<size_type>(i2 - i1), s);
+  }
+  small_string& replace(const_iterator i1, const_iterator i2,
+      const char * s, size_type n) {
+    return replace(offset(i1), static_cast<size_type>(i2 - i1), s, n);
+  }
+  small_string& replace(const_iterator i1, const_iterator i2,
+      size_type n, char c) {
+    return replace(offset(i1), static_cast<size_type>(i2 - i1), n, c);
+  }
+  template <std::input_iterator It>
+  small_string& replace(const_iterator i1, const_iterator i2, It j1, It j2) {
+    return replace(i1, i2, small_string(j1, j2));
+  }
+  small_string& replace(const_iterator i1, const_iterator i2,
+      std::initializer_list<char> il) {
+    return replace(i1, i2, il.begin(), il.size());
+  }
+
+  small_string& append(const char * s, size_type n) {
+    return replace(size(), 0, s, n);
+  }
+  small_string& append(view_type s) { return append(s.data(), s.size()); }
+  small_string& append(const char * s) { return append(view_type(s)); }
+  small_string& append(const small_string& s, size_type pos,
+      size_type n = npos) {
+    return append(view_type(s).substr(pos, n));
+  }
+  small_string& append(size_type n, char c) {
+    const size_type old = size();
+    if (old + n > max_size()) throw std::length_error("opaque::small_string");
+    reserve(old + n);
+    std::memset(data() + old, c, n);
+    set_size(old + n);
+    return *this;
+  }
+  template <std::input_iterator It>
+  small_string& append(It first, It last) {
+    if constexpr (std::forward_iterator<It>) {
+      reserve(size() + static_cast<size_type>(std::distance(first, last)));
+    }
+    for (; first != last; ++first) push_back(*first);
+    return *this;
+  }
+  small_string& append(std::initializer_list<char> il) {
+    return append(il.begin(), il.size());
+  }
+  void push_back(char c) { append(1, c); }
+  void pop_back() { erase(size() - 1, 1); }
+
+  small_string& operator+=(view_type s) { return append(s); }
+  small_string& operator+=(const char * s) { return append(s); }
+  small_string& operator+=(char c) { push_back(c); return *this; }
+  small_string& operator+=(std::initializer_list<char> il) {
+    return append(il);
+  }
+
+  small_string& assign(view_type s) { return replace(0, npos, s); }
+  small_string& assign(const char * s, size_type n) {
+    return replace(0, npos, s, n);
+  }
+  small_string& assign(const char * s) { return assign(view_type(s)); }
+  small_string& assign(const small_string& s, size_type pos,
+      size_type n = npos) {
+    return assign(view_type(s).substr(pos, n));
+  }
+  small_string& assign(small_string&& s) noexcept {
+    if constexpr (Spill) return *this = std::move(s);
+    else { *this = s; return *this; }
+  }
+  small_string& assign(size_type n, char c) {
+    clear();
+    return append(n, c);
+  }
+  template <std::input_iterator It>
+  small_string& assign(It first, It last) {
+    return assign(small_string(first, last));
+  }
+  small_string& assign(std::initializer_list<char> il) {
+    return assign(il.begin(), il.size());
+  }
+
+  small_string& insert(size_type pos, view_type s) {
+    return replace(pos, 0, s);
+  }
+  small_string& insert(size_type pos, const char * s, size_type n) {
+    return replace(pos, 0, s, n);
+  }
+  small_string& insert(size_type pos1, const small_string& s,
+      size_type pos2, size_type n = npos) {
+    return replace(pos1, 0, s, pos2, n);
+  }
+  small_string& insert(size_type pos, size_type n, char c) {
+    return replace(pos, 0, n, c);
+  }
+
+  small_string& erase(size_type pos = 0, size_type n = npos) {
+    const size_type sz = size();
+    if (pos > sz) throw std::out_of_range("opaque::small_string");
+    n = std::min(n, sz - pos);
+    if (n == sz - pos and not spilled()) {
+      // Truncating an inline string: restore the zero padding
+      std::memset(buf_ + pos, 0, sz - pos);
+      set_inline_size(pos);
+      return *this;
+    }
+    return replace(pos, n, "", 0);
+  }
+  iterator erase(const_iterator p) {
+    const size_type i = offset(p);
+    erase(i, 1);
+    return data() + i;
+  }
+  iterator erase(const_iterator first, const_iterator last) {
+    const size_type i = offset(first);
+    erase(i, static_cast<size_type>(last - first));
+    return data() + i;
+  }
+
+  void swap(small_string& s) noexcept {
+    char tmp[bytes];
+    std::memcpy(tmp, s.buf_, bytes);
+    std::memcpy(s.buf_, buf_, bytes);
+    std::memcpy(buf_, tmp, bytes);
+  }
+  friend void swap(small_string& a, small_string& b) noexcept { a.swap(b); }
+
+  //
+  // Operations that only read are those of std::string_view
+  //
+
+  size_type copy(char * s, size_type n, size_type pos = 0) const {
+    return view_type(*this).copy(s, n, pos);
+  }
+
+  small_string substr(size_type pos = 0, size_type n = npos) const {
+    return small_string(view_type(*this).substr(pos, n));
+  }
+
+  template <typename... Args>
+  size_type find(Args&&... args) const {
+    return view_type(*this).find(std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  size_type rfind(Args&&... args) const {
+    return view_type(*this).rfind(std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  size_type find_first_of(Args&&... args) const {
+    return view_type(*this).find_first_of(std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  size_type find_last_of(Args&&... args) const {
+    return view_type(*this).find_last_of(std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  size_type find_first_not_of(Args&&... args) const {
+    return view_type(*this).find_first_not_of(std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  size_type find_last_not_of(Args&&... args) const {
+    return view_type(*this).find_last_not_of(std::forward<Args>(args)...);
+  }
+  template <typename... Args>
+  int compare(Args&&... args) const {
+    return view_type(*this).compare(std::forward<Args>(args)...);
+  }
+  bool starts_with(view_type s) const noexcept {
+    return view_type(*this).starts_with(s);
+  }
+  bool ends_with(view_type s) const noexcept {
+    return view_type(*this).ends_with(s);
+  }
+
+  //
+  // Comparison
+  //
+
+  friend bool operator==(const small_string& a, const small_string& b)
+    noexcept {
+    if (not a.spilled() and not b.spilled()) {
+      return std::memcmp(a.buf_, b.buf_, bytes) == 0;
+    }
+    return view_type(a) == view_type(b);
+  }
+  friend std::strong_ordering operator<=>(const small_string& a,
+      const small_string& b) noexcept {
+    return view_type(a) <=> view_type(b);
+  }
+  friend bool operator==(const small_string& a, view_type b) noexcept {
+    return view_type(a) == b;
+  }
+  friend std::strong_ordering operator<=>(const small_string& a,
+      view_type b) noexcept {
+    return view_type(a) <=> b;
+  }
+  // A literal converts equally well to small_string and to view_type
+  friend bool operator==(const small_string& a, const char * b) noexcept {
+    return view_type(a) == view_type(b);
+  }
+  friend std::strong_ordering operator<=>(const small_string& a,
+      const char * b) noexcept {
+    return view_type(a) <=> view_type(b);
+  }
+
+  friend small_string operator+(const small_string& l, view_type r) {
+    small_string s;
+    s.reserve(l.size() + r.size());
+    s.append(l).append(r);
+    return s;
+  }
+  friend small_string operator+(small_string&& l, view_type r) {
+    l.append(r);
+    return std::move(l);
+  }
+  friend small_string operator+(const small_string& l, const small_string& r) {
+    return l + view_type(r);
+  }
+  friend small_string operator+(small_string&& l, const small_string& r) {
+    return std::move(l) + view_type(r);
+  }
+  friend small_string operator+(view_type l, small_string&& r) {
+    r.insert(0, l);
+    return std::move(r);
+  }
+  friend small_string operator+(const small_string& l, small_string&& r) {
+    return view_type(l) + std::move(r);
+  }
+  friend small_string operator+(small_string&& l, small_string&& r) {
+    return std::move(l) + view_type(r);
+  }
+  friend small_string operator+(small_string l, char c) {
+    l.push_back(c);
+    return l;
+  }
+  friend small_string operator+(char c, small_string r) {
+    r.insert(0, 1, c);
+    return r;
+  }
+
+private:
+  template <typename T>
+  T load(std::size_t at) const noexcept {
+    T r;
+    std::memcpy(&r, buf_ + at, sizeof(T));
+    return r;
+  }
+  template <typename T>
+  void store(std::size_t at, T v) noexcept {
+    std::memcpy(buf_ + at, &v, sizeof(T));
+  }
+
+  size_type heap_capacity() const noexcept {
+    return size_type{1} << static_cast<unsigned char>(buf_[log_offset]);
+  }
+
+  static unsigned log_capacity_for(size_type n) noexcept {
+    return static_cast<unsigned>(std::bit_width(n));
+  }
+
+  size_type check(size_type pos) const {
+    if (pos >= size()) throw std::out_of_range("opaque::small_string::at");
+    return pos;
+  }
+
+  size_type offset(const_iterator p) const noexcept {
+    return static_cast<size_type>(p - data());
+  }
+
+  void set_inline_size(size_type n) noexcept {
+    buf_[n < inline_capacity ? n : inline_capacity] = '\0';
+    buf_[inline_capacity] = static_cast<char>(inline_capacity - n);
+  }
+
+  void set_heap(char * p, size_type n, unsigned lg) noexcept {
+    store(0, p);
+    store(size_offset, static_cast<std::uint32_t>(n));
+    buf_[log_offset] = static_cast<char>(lg);
+    buf_[inline_capacity] = spilled_tag;
+    p[n] = '\0';
+  }
+
+  /// Record a new size after writing characters in place
+  void set_size(size_type n) noexcept {
+    if (spilled()) {
+      store(size_offset, static_cast<std::uint32_t>(n));
+      load<char *>(0)[n] = '\0';
+    } else {
+      set_inline_size(n);
+    }
+  }
+
+  /// Move to a heap block of room for at least n characters
+  void reallocate(size_type n) {
+    if constexpr (Spill) {
+      if (n > max_size()) throw std::length_error("opaque::small_string");
+      const size_type sz = size();
+      const unsigned lg = log_capacity_for(n);
+      char * p = new char[std::size_t{1} << lg];
+      std::memcpy(p, data(), sz);
+      release();
+      set_heap(p, sz, lg);
+    } else {
+      (void)n;
+      throw std::length_error("opaque::small_string");
+    }
+  }
+
+  /// Become empty without freeing anything
+  void reset() noexcept {
+    std::memset(buf_, 0, bytes);
+    set_inline_size(0);
+  }
+
+  void release() noexcept {
+    if (spilled()) {
+      delete[] load<char *>(0);
+      reset();
+    }
+  }
+
+  alignas(Spill ? alignof(char *) : 1) char buf_[bytes] = {};
+};
+
+/// @}
+
+}
+
+///
+/// Hash a small_string as std::hash hashes the equal std::string_view
+///
+/// hash_policy::seeded likewise treats small_string as any other string of
+/// bytes, so both policies agree with string_view_typedef lookups.
+///
+template <std::size_t N, bool Spill>
+struct std::hash<opaque::small_string<N, Spill>> {
+  using argument_type = opaque::small_string<N, Spill>;
+  using result_type = std::size_t;
+  result_type operator()(const argument_type& s) const noexcept {
+    return std::hash<std::string_view>{}(std::string_view(s));
+  }
+};
+
+#endif
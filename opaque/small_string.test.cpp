@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/small_string.hpp"
+#include "arrtest/arrtest.hpp"
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+UNIT_TEST_MAIN
+
+using small = opaque::small_string<15>;
+using fixed = opaque::small_string<7, false>;
+
+static_assert(sizeof(small) == 16);
+static_assert(small::inline_capacity == 15);
+static_assert(sizeof(opaque::small_string<23>) == 24);
+static_assert(sizeof(fixed) == 8);
+static_assert(std::is_trivially_copyable_v<fixed>);
+static_assert(not std::is_trivially_copyable_v<small>);
+
+TEST(inline_storage) {
+  small s("AAPL");
+  CHECK_EQUAL(4u, s.size());
+  CHECK_EQUAL(false, s.spilled());
+  CHECK(std::string_view(s) == "AAPL");
+  CHECK_EQUAL('\0', s.c_str()[4]);
+  s.append("-123456789A");
+  CHECK_EQUAL(15u, s.size());
+  CHECK_EQUAL(false, s.spilled());
+  CHECK_EQUAL('\0', s.c_str()[15]);
+  CHECK(s == small("AAPL-123456789A"));
+}
+
+TEST(spill_and_return) {
+  small s("a string that is long enough to spill");
+  CHECK_EQUAL(true, s.spilled());
+  CHECK(s == std::string_view("a string that is long enough to spill"));
+  const small copy(s);
+  CHECK(copy == s);
+  CHECK(copy.data() != s.data());
+  s.erase(4);
+  CHECK_EQUAL(false, s.spilled());
+  CHECK(s == small("a st"));
+  small source(copy);
+  small moved(std::move(source));
+  CHECK_EQUAL(true, moved.spilled());
+  CHECK(moved == copy);
+  CHECK(source.empty());
+  CHECK(source == small());
+}
+
+TEST(fixed_capacity) {
+  fixed f("ABCDEFG");
+  CHECK_EQUAL(7u, f.size());
+  try {
+    f.push_back('H');
+    CHECK_CATCH(std::length_error, e);
+  }
+  CHECK(f == std::string_view("ABCDEFG"));
+}
+
+TEST(self_referencing_edits) {
+  small s("abc");
+  s.append(s);
+  CHECK(s == std::string_view("abcabc"));
+  s.append(s).append(s);
+  CHECK(s == std::string_view("abcabcabcabcabcabcabcabc"));
+  s.insert(3, s.data(), 6);
+  CHECK(s.substr(0, 12) == std::string_view("abcabcabcabc"));
+  s.replace(0, s.size(), s.end() - 3, 3);
+  CHECK(s == std::string_view("abc"));
+}
+
+TEST(matches_std_string) {
+  std::mt19937 rng(7);
+  small s;
+  std::string ref;
+  for (int i = 0; i < 20000; ++i) {
+    const auto pos = ref.empty() ? 0 : rng() % (ref.size() + 1);
+    switch (rng() % 6) {
+      case 0: s.push_back(char('a' + i % 26)); ref.push_back(char('a' + i % 26)); break;
+      case 1: s.append(3, 'x'); ref.append(3, 'x'); break;
+      case 2: s.insert(pos, "ins"); ref.insert(pos, "ins"); break;
+      case 3: s.erase(pos, 5); ref.erase(pos, 5); break;
+      case 4: s.resize(ref.size() / 2); ref.resize(ref.size() / 2); break;
+      default: s.replace(pos, 2, "REP"); ref.replace(pos, 2, "REP"); break;
+    }
+    CHECK(std::string_view(s) == ref);
+    CHECK_EQUAL(ref.size() > small::inline_capacity, s.spilled());
+  }
+}
+
+TEST(comparison_and_search) {
+  const small a("MSFT"), b("MSFU"), c("a string that is long enough to spill");
+  CHECK(a < b);
+  CHECK(a != b);
+  CHECK(a < c);
+  CHECK_EQUAL(2u, a.find("FT"));
+  CHECK_EQUAL(small::npos, a.find('Z'));
+  CHECK(a.compare(b) < 0);
+  CHECK(a + b == small("MSFTMSFU"));
+  CHECK(a + c == std::string_view("MSFTa string that is long enough to spill"));
+  CHECK_EQUAL(std::hash<std::string_view>{}("MSFT"), std::hash<small>{}(a));
+}
+
+TEST(compare_with_literals_and_strings) {
+  const small s("abc"), l("a string that is long enough to spill");
+  CHECK(s == "abc");
+  CHECK("abc" == s);
+  CHECK(s != "abd");
+  CHECK(s < "abd");
+  CHECK("abb" < s);
+  CHECK(s >= "abc");
+  CHECK(l == "a string that is long enough to spill");
+  const std::string t("abc"), u("abd");
+  CHECK(s == t);
+  CHECK(t == s);
+  CHECK(s < u);
+  CHECK(u > s);
+  CHECK(l != t);
+}
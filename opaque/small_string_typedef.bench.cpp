@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/small_string_typedef.hpp"
+#include "opaque/safer_string_typedef.hpp"
+#include "opaque/flat_map.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+struct std_ticker
+  : opaque::experimental::safer_string_typedef<std::string, std_ticker> {
+  using base = opaque::experimental::safer_string_typedef<std::string, std_ticker>;
+  using base::base;
+};
+
+struct ticker : opaque::experimental::small_string_typedef<15, ticker> {
+  using base = opaque::experimental::small_string_typedef<15, ticker>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(std_ticker, opaque::hash_policy::seeded<>)
+OPAQUE_HASHABLE(ticker, opaque::hash_policy::seeded<>)
+
+template <typename T>
+void run(const char * name, const std::vector<std::string>& text,
+    const std::vector<std::size_t>& probes) {
+  std::printf("%s: %zu bytes per element\n", name, sizeof(T));
+  std::vector<T> v;
+  v.reserve(text.size());
+  measure("  construct", text.size(), [&] {
+    for (const auto& t : text) v.emplace_back(t.data(), t.size());
+  });
+  std::vector<T> sorted = v;
+  measure("  sort", sorted.size(), [&] {
+    std::sort(sorted.begin(), sorted.end());
+  });
+  measure("  == against neighbour", v.size(), [&] {
+    std::size_t eq = 0;
+    for (std::size_t i = 1; i < sorted.size(); ++i) {
+      eq += sorted[i] == sorted[i - 1];
+    }
+    keep(eq);
+  });
+  opaque::flat_map<T, std::size_t> m;
+  for (std::size_t i = 0; i < v.size(); ++i) m.try_emplace(v[i], i);
+  measure("  flat_map find", probes.size(), [&] {
+    std::size_t found = 0;
+    for (auto i : probes) found += m.find(v[i])->second;
+    keep(found);
+  });
+}
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 1000000);
+  std::mt19937 rng(11);
+  std::vector<std::string> text;
+  for (std::size_t i = 0; i < n; ++i) {
+    // Symbols of 8 to 15 characters, as for option and futures tickers
+    std::string s;
+    const std::size_t len = 8 + rng() % 8;
+    for (std::size_t j = 0; j < len; ++j) s += char('A' + rng() % 26);
+    text.push_back(s);
+  }
+  std::vector<std::size_t> probes;
+  for (std::size_t i = 0; i < n; ++i) probes.push_back(rng() % n);
+
+  run<std_ticker>("safer_string_typedef<std::string>", text, probes);
+  run<ticker>("small_string_typedef<15>", text, probes);
+}
@@ -0,0 +1,87 @@
+#ifndef OPAQUE_SMALL_STRING_TYPEDEF_HPP
+#define OPAQUE_SMALL_STRING_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/safer_string_typedef.hpp"
+#include "opaque/small_string.hpp"
+#include <cstddef>
+#include <string_view>
+
+namespace opaque {
+namespace experimental {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Safer string typedef over a small_string
+///
+/// Short values are stored inside the object: with N = 15 an instance is
+/// 16 bytes, half the size of a std::string, so arrays and tables of short
+/// keys such as ticker symbols take half the memory.  Equality of two
+/// inline values compares the object representation a word at a time.
+///
+/// With Spill false the typedef is trivially copyable, and values longer
+/// than the inline capacity throw std::length_error.
+///
+/// Template arguments:
+///  -# N : The minimum number of characters stored inline
+///  -# O : The result type, your subclass
+///  -# Spill : Whether longer values move to the heap
+///
+template <std::size_t N, typename O, bool Spill = true>
+struct small_string_typedef
+  : safer_string_typedef<opaque::small_string<N, Spill>, O> {
+private:
+  using base = safer_string_typedef<opaque::small_string<N, Spill>, O>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using base::value;
+
+  static constexpr std::size_t inline_capacity =
+    underlying_type::inline_capacity;
+
+  using base::base;
+
+  explicit small_string_typedef(std::string_view s)
+    : base(underlying_type(s)) { }
+
+  /// Whether the characters are on the heap
+  bool spilled() const noexcept { return value.spilled(); }
+
+  std::string_view view() const noexcept { return std::string_view(value); }
+};
+
+/// @}
+
+}
+}
+
+#endif
@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/small_string_typedef.hpp"
+#include "opaque/string_view_typedef.hpp"
+#include "opaque/flat_map.hpp"
+#include "arrtest/arrtest.hpp"
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+
+UNIT_TEST_MAIN
+
+struct ticker : opaque::experimental::small_string_typedef<15, ticker> {
+  using base = opaque::experimental::small_string_typedef<15, ticker>;
+  using base::base;
+};
+
+struct mic : opaque::experimental::small_string_typedef<7, mic, false> {
+  using base = opaque::experimental::small_string_typedef<7, mic, false>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE_TRANSPARENT(ticker)
+OPAQUE_HASHABLE(mic, opaque::hash_policy::seeded<>)
+
+using ticker_view = opaque::experimental::string_view_typedef<ticker>;
+
+static_assert(sizeof(ticker) == 16);
+static_assert(sizeof(ticker) * 2 <= sizeof(std::string));
+static_assert(sizeof(mic) == 8);
+static_assert(std::is_trivially_copyable_v<mic>);
+static_assert(not std::is_convertible_v<const char *, ticker>);
+static_assert(not std::is_convertible_v<ticker, mic>);
+
+TEST(safer_string_interface) {
+  ticker t("BRK");
+  t += ticker(".B");
+  CHECK(t == ticker("BRK.B"));
+  CHECK_EQUAL(5u, t.size());
+  CHECK_EQUAL(3u, t.find('.'));
+  CHECK(t.substr(0, 3) == ticker("BRK"));
+  CHECK(t + ticker(".XNYS") == ticker("BRK.B.XNYS"));
+  CHECK(t < ticker("BRL"));
+  CHECK(t.view() == "BRK.B");
+  CHECK_EQUAL(false, t.spilled());
+  t.append(ticker(" a long company name"));
+  CHECK_EQUAL(true, t.spilled());
+}
+
+TEST(fixed_capacity) {
+  mic m("XNAS");
+  CHECK_EQUAL(std::hash<mic>{}(m), std::hash<mic>{}(mic("XNAS")));
+  try {
+    m += mic("XNYS");
+    CHECK_CATCH(std::length_error, e);
+  }
+}
+
+TEST(transparent_lookup) {
+  std::unordered_set<ticker> s{ticker("IBM"), ticker("GOOGL")};
+  const char wire[] = "GOOGL";
+  CHECK_EQUAL(1u, s.count(ticker("IBM")));
+  CHECK_EQUAL(true, s.find(ticker_view(wire, 5)) != s.end());
+  opaque::flat_map<ticker, int> m;
+  m[ticker("IBM")] = 1;
+  CHECK_EQUAL(1, m.find(ticker_view("IBM", 3))->second);
+}
@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/static_map.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/string_typedef.hpp"
+#include "opaque/string_view_typedef.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+struct venue_id : opaque::numeric_typedef<unsigned, venue_id> {
+  using base = opaque::numeric_typedef<unsigned, venue_id>;
+  using base::base;
+};
+
+struct currency : opaque::experimental::string_typedef<std::string, currency> {
+  using base = opaque::experimental::string_typedef<std::string, currency>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(venue_id)
+OPAQUE_HASHABLE_TRANSPARENT(currency)
+
+using currency_view = opaque::experimental::string_view_typedef<currency>;
+
+#define VENUES(X) \
+  X(  2) X(  3) X(  5) X(  7) X( 11) X( 13) X( 17) X( 19) \
+  X( 23) X( 29) X( 31) X( 37) X( 41) X( 43) X( 47) X( 53) \
+  X(101) X(103) X(107) X(109) X(113) X(127) X(131) X(137) \
+  X(401) X(409) X(419) X(421) X(431) X(433) X(439) X(443)
+
+#define VENUE_ENTRY(v) { venue_id(v##u), v },
+constexpr auto venues = opaque::make_static_map<venue_id, int>({
+  VENUES(VENUE_ENTRY)
+});
+
+#define VENUE_CASE(v) case v: return v;
+int venue_switch(venue_id id) {
+  switch (id.value) {
+    VENUES(VENUE_CASE)
+    default: return -1;
+  }
+}
+
+using namespace std::literals;
+constexpr std::string_view codes[] = {
+  "AED", "AUD", "BHD", "BRL", "CAD", "CHF", "CLF", "CNY",
+  "CZK", "DKK", "EUR", "GBP", "HKD", "HUF", "IDR", "ILS",
+  "INR", "JPY", "KRW", "KWD", "MXN", "NOK", "NZD", "PLN",
+  "RUB", "SAR", "SEK", "SGD", "THB", "TRY", "USD", "ZAR",
+};
+
+template <std::size_t... I>
+constexpr auto make_currencies(std::index_sequence<I...>) {
+  return opaque::make_static_map<currency_view, int>({
+    { currency_view(codes[I]), static_cast<int>(I) }...
+  });
+}
+constexpr auto currencies =
+  make_currencies(std::make_index_sequence<std::size(codes)>());
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 10000000);
+  std::mt19937 rng(3);
+
+  std::vector<venue_id> ids;
+  const unsigned known[] = { 2, 43, 131, 443, 6, 500 };
+  for (std::size_t i = 0; i < n; ++i) ids.emplace_back(known[rng() % 6]);
+
+  std::unordered_map<venue_id, int> venue_map;
+#define VENUE_INSERT(v) venue_map.emplace(venue_id(v##u), v);
+  VENUES(VENUE_INSERT)
+
+  measure("venue static_map", n, [&] {
+    long sum = 0;
+    for (const auto& id : ids) {
+      const int * v = venues.find(id);
+      sum += v ? *v : -1;
+    }
+    keep(sum);
+  });
+  measure("venue switch", n, [&] {
+    long sum = 0;
+    for (const auto& id : ids) sum += venue_switch(id);
+    keep(sum);
+  });
+  measure("venue unordered_map", n, [&] {
+    long sum = 0;
+    for (const auto& id : ids) {
+      auto it = venue_map.find(id);
+      sum += it != venue_map.end() ? it->second : -1;
+    }
+    keep(sum);
+  });
+
+  std::vector<currency> ccys;
+  for (std::size_t i = 0; i < n; ++i) {
+    ccys.emplace_back(std::string(codes[rng() % std::size(codes)]));
+  }
+  std::unordered_map<currency, int> currency_map;
+  for (std::size_t i = 0; i < std::size(codes); ++i) {
+    currency_map.emplace(currency(std::string(codes[i])), static_cast<int>(i));
+  }
+
+  measure("currency static_map", n, [&] {
+    long sum = 0;
+    for (const auto& c : ccys) {
+      const int * v = currencies.find(currency_view(c));
+      sum += v ? *v : -1;
+    }
+    keep(sum);
+  });
+  measure("currency unordered_map", n, [&] {
+    long sum = 0;
+    for (const auto& c : ccys) {
+      auto it = currency_map.find(c);
+      sum += it != currency_map.end() ? it->second : -1;
+    }
+    keep(sum);
+  });
+}
@@ -0,0 +1,213 @@
+#ifndef OPAQUE_STATIC_MAP_HPP
+#define OPAQUE_STATIC_MAP_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/storage.hpp"
+#include "opaque/hash.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Immutable map from a fixed set of opaque keys, with a perfect hash
+/// computed at compile time
+///
+/// Construction finds, for every first-level bucket of keys, a hash seed
+/// that sends each of its keys to a distinct slot ("hash and displace").
+/// A lookup then costs one hash of the key, one integer mix and one key
+/// comparison, regardless of which keys are present, and never probes a
+/// second slot.
+///
+/// Keys are hashed with hash_policy::seeded, so their underlying type must
+/// be hashable in a constant expression: an integer, an enumeration, or a
+/// string of bytes such as the std::string_view inside a
+/// string_view_typedef.  Use make_static_map to deduce the size.
+///
+/// Template arguments:
+///  -# K : The key type, an opaque typedef
+///  -# V : The mapped type, which must be a literal type
+///  -# N : The number of entries
+///
+template <typename K, typename V, std::size_t N>
+class static_map {
+  static_assert(N > 0, "static_map requires at least one entry");
+  static constexpr std::size_t slots = std::bit_ceil(N);
+
+  static constexpr std::uint64_t hash(const K& key) noexcept {
+    return hash_policy::seeded<>{}(key.value);
+  }
+
+  static constexpr std::size_t bucket(std::uint64_t h) noexcept {
+    return static_cast<std::size_t>(h) & (slots - 1);
+  }
+
+  static constexpr std::size_t slot(std::uint64_t h, std::uint64_t seed)
+    noexcept {
+    return static_cast<std::size_t>(detail::mix64(h ^ seed)) & (slots - 1);
+  }
+
+public:
+  using key_type    = K;
+  using mapped_type = V;
+  using value_type  = std::pair<K, V>;
+  using size_type   = std::size_t;
+
+  constexpr explicit static_map(const value_type (&entries)[N]) {
+    build(entries);
+  }
+
+  static constexpr size_type size() noexcept { return N; }
+
+  /// Return a pointer to the value for a key, or nullptr if it is absent
+  constexpr const V * find(const K& key) const noexcept {
+    const std::uint64_t h = hash(key);
+    const std::size_t s = slot(h, seeds[bucket(h)]);
+    return keys[s] == key ? &values[s] : nullptr;
+  }
+
+  constexpr bool contains(const K& key) const noexcept {
+    return find(key) != nullptr;
+  }
+
+  constexpr const V& at(const K& key) const {
+    const V * v = find(key);
+    if (not v) throw std::out_of_range("opaque::static_map::at");
+    return *v;
+  }
+
+  template <typename Q> const V * find(const Q&) const = delete;
+  template <typename Q> bool contains(const Q&) const = delete;
+
+private:
+  constexpr void build(const value_type (&entries)[N]) {
+    std::array<std::uint64_t, N> hashes{};
+    std::array<std::size_t, N> bucket_of{};
+    std::array<std::size_t, slots> bucket_size{};
+    for (std::size_t i = 0; i < N; ++i) {
+      hashes[i] = hash(entries[i].first);
+      bucket_of[i] = bucket(hashes[i]);
+      ++bucket_size[bucket_of[i]];
+    }
+
+    // Place the largest buckets first, while most slots are free
+    std::array<std::size_t, slots> order{};
+    for (std::size_t b = 0; b < slots; ++b) order[b] = b;
+    std::sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+      return bucket_size[a] > bucket_size[b];
+    });
+
+    std::array<bool, slots> used{};
+    std::array<std::size_t, N> members{};
+    std::array<std::size_t, N> placed{};
+    seeds = {};
+    for (const std::size_t b : order) {
+      if (bucket_size[b] == 0) break;
+      std::size_t count = 0;
+      for (std::size_t i = 0; i < N; ++i) {
+        if (bucket_of[i] != b) continue;
+        for (std::size_t j = 0; j < count; ++j) {
+          // Keys with equal hashes could never be separated by a seed
+          if (hashes[members[j]] == hashes[i]) {
+            throw std::invalid_argument(
+                entries[members[j]].first == entries[i].first
+                ? "opaque::static_map duplicate key"
+                : "opaque::static_map keys with equal hashes");
+          }
+        }
+        members[count++] = i;
+      }
+      for (std::uint64_t seed = 1; ; ++seed) {
+        bool fits = true;
+        for (std::size_t j = 0; fits and j < count; ++j) {
+          placed[j] = slot(hashes[members[j]], seed);
+          fits = not used[placed[j]];
+          for (std::size_t k = 0; fits and k < j; ++k) {
+            fits = placed[k] != placed[j];
+          }
+        }
+        if (fits) {
+          seeds[b] = seed;
+          for (std::size_t j = 0; j < count; ++j) {
+            used[placed[j]] = true;
+            keys[placed[j]]   = entries[members[j]].first;
+            values[placed[j]] = entries[members[j]].second;
+          }
+          break;
+        }
+      }
+    }
+
+    //
+    // Fill unused slots with the first entry.  Its key hashes to its own
+    // slot, so it can never be found in any other, and the comparison in
+    // find() needs no separate occupancy check.
+    //
+    for (std::size_t s = 0; s < slots; ++s) {
+      if (used[s]) continue;
+      keys[s]   = entries[0].first;
+      values[s] = entries[0].second;
+    }
+  }
+
+  std::array<std::uint64_t, slots> seeds;
+  std::array<K, slots> keys;
+  std::array<V, slots> values;
+};
+
+///
+/// Create a static_map from a braced list of entries
+///
+/// Example usage:
+/// \code
+/// constexpr auto codes = opaque::make_static_map<venue_id, int>({
+///   { venue_id(17), 0 },
+///   { venue_id(42), 1 },
+/// });
+/// \endcode
+///
+template <typename K, typename V, std::size_t N>
+constexpr static_map<K, V, N> make_static_map(
+    const std::pair<K, V> (&entries)[N]) {
+  return static_map<K, V, N>(entries);
+}
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,114 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/static_map.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/string_typedef.hpp"
+#include "opaque/string_view_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <string>
+#include <string_view>
+
+UNIT_TEST_MAIN
+
+struct venue_id : opaque::numeric_typedef<unsigned, venue_id> {
+  using base = opaque::numeric_typedef<unsigned, venue_id>;
+  using base::base;
+};
+
+struct currency : opaque::experimental::string_typedef<std::string, currency> {
+  using base = opaque::experimental::string_typedef<std::string, currency>;
+  using base::base;
+};
+
+using currency_view = opaque::experimental::string_view_typedef<currency>;
+
+constexpr auto venues = opaque::make_static_map<venue_id, int>({
+  { venue_id(17u), 0 },
+  { venue_id(42u), 1 },
+  { venue_id( 3u), 2 },
+  { venue_id(99u), 3 },
+  { venue_id( 0u), 4 },
+});
+
+using namespace std::literals;
+constexpr auto digits = opaque::make_static_map<currency_view, int>({
+  { currency_view("USD"sv), 2 },
+  { currency_view("JPY"sv), 0 },
+  { currency_view("EUR"sv), 2 },
+  { currency_view("BHD"sv), 3 },
+  { currency_view("CLF"sv), 4 },
+  { currency_view("GBP"sv), 2 },
+});
+
+static_assert(venues.size() == 5);
+static_assert(*venues.find(venue_id(42u)) == 1);
+static_assert(*venues.find(venue_id( 0u)) == 4);
+static_assert(not venues.contains(venue_id(1u)));
+static_assert(digits.at(currency_view("BHD"sv)) == 3);
+static_assert(not digits.contains(currency_view("XXX"sv)));
+
+template <typename M, typename Q>
+concept can_find = requires(const M& m, const Q& q) { m.find(q); };
+static_assert(not can_find<decltype(venues), unsigned>);
+
+TEST(numeric) {
+  for (unsigned i = 0; i < 200; ++i) {
+    const bool present = i == 17 or i == 42 or i == 3 or i == 99 or i == 0;
+    CHECK_EQUAL(present, venues.contains(venue_id(i)));
+  }
+  CHECK_EQUAL(3, venues.at(venue_id(99u)));
+  try {
+    venues.at(venue_id(100u));
+    CHECK_CATCH(std::out_of_range, e);
+  }
+}
+
+TEST(strings) {
+  const currency usd("USD");
+  CHECK_EQUAL(2, digits.at(currency_view(usd)));
+  CHECK_EQUAL(0, digits.at(currency_view(currency("JPY"))));
+  CHECK_EQUAL(false, digits.contains(currency_view(currency("US"))));
+}
+
+TEST(larger) {
+  // Build at run time too: every key is found, nothing else is
+  std::pair<venue_id, int> entries[300];
+  for (unsigned i = 0; i < 300; ++i) {
+    entries[i] = { venue_id(i * 7919u), static_cast<int>(i) };
+  }
+  const opaque::static_map<venue_id, int, 300> m(entries);
+  int found = 0;
+  for (unsigned i = 0; i < 300 * 7919u; ++i) {
+    if (const int * v = m.find(venue_id(i))) {
+      CHECK_EQUAL(static_cast<int>(i / 7919u), *v);
+      ++found;
+    }
+  }
+  CHECK_EQUAL(300, found);
+}
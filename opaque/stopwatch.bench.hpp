@@ -0,0 +1,74 @@
+#ifndef STOPWATCH_BENCH_HPP
+#define STOPWATCH_BENCH_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+
+//
+// Minimal timing support for the *.bench.cpp programs
+//
+// Each benchmark is a plain executable that prints one line per measurement.
+// The first command-line argument, if present, overrides the problem size.
+//
+
+inline std::size_t bench_size(int argc, char * argv[], std::size_t fallback) {
+  if (argc > 1) {
+    const auto n = std::strtoull(argv[1], nullptr, 10);
+    if (n > 0) return static_cast<std::size_t>(n);
+  }
+  return fallback;
+}
+
+/// Prevent the optimizer from discarding a computed value
+template <typename T>
+inline void keep(const T& value) noexcept {
+#if defined(__GNUC__)
+  __asm__ __volatile__("" : : "m"(value) : "memory");
+#else
+  static volatile const void * sink;
+  sink = &value;
+#endif
+}
+
+/// Time a callable and report nanoseconds per operation
+template <typename F>
+inline double measure(const char * label, std::size_t ops, F&& f) {
+  const auto start = std::chrono::steady_clock::now();
+  f();
+  const std::chrono::duration<double, std::nano> elapsed =
+    std::chrono::steady_clock::now() - start;
+  const double per_op = elapsed.count() / static_cast<double>(ops ? ops : 1);
+  std::printf("%-52s %12.2f ns/op\n", label, per_op);
+  return per_op;
+}
+
+#endif
@@ -1,7 +1,7 @@
 #ifndef OPAQUE_STORAGE_HPP
 #define OPAQUE_STORAGE_HPP
 //
-// Copyright (c) 2021
+// Copyright (c) 2021, 2026
 // Kyle Markley.  All rights reserved.
 //
 // Redistribution and use in source and binary forms, with or without
@@ -88,6 +88,10 @@ struct opaque_storage : actual_storage<U> {
   not_another_opaque_typedef = not std::is_base_of_v<opaque_tag, T>;
 
   opaque_storage() = default;
+  opaque_storage(const opaque_storage& ) = default;
+  opaque_storage(      opaque_storage&&) = default;
+  opaque_storage& operator=(const opaque_storage& ) & = default;
+  opaque_storage& operator=(      opaque_storage&&) & = default;
 
   template <typename Arg1, typename... Args>
   requires not_another_opaque_typedef<Arg1>
@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/string_view_typedef.hpp"
+#include "opaque/safer_string_typedef.hpp"
+#include "opaque/flat_map.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//
+// Count heap allocations so that the report shows what each lookup costs
+//
+static std::atomic<std::size_t> allocations{0};
+
+void * operator new(std::size_t n) {
+  ++allocations;
+  if (void * p = std::malloc(n ? n : 1)) return p;
+  throw std::bad_alloc();
+}
+void operator delete(void * p) noexcept { std::free(p); }
+void operator delete(void * p, std::size_t) noexcept { std::free(p); }
+
+struct tag_key
+  : opaque::experimental::safer_string_typedef<std::string, tag_key> {
+  using base = opaque::experimental::safer_string_typedef<std::string, tag_key>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE_TRANSPARENT(tag_key, opaque::hash_policy::seeded<>)
+
+using tag_view = opaque::experimental::string_view_typedef<tag_key>;
+
+template <typename Map, typename Make>
+void run(const char * label, const Map& m, const std::string& wire,
+    const std::vector<std::size_t>& offsets, std::size_t length, Make&& make) {
+  const std::size_t before = allocations;
+  measure(label, offsets.size(), [&] {
+    std::size_t found = 0;
+    for (auto off : offsets) found += m.count(make(wire.data() + off, length));
+    keep(found);
+  });
+  std::printf("%52s %12.2f allocations/op\n", "",
+      static_cast<double>(allocations - before) /
+      static_cast<double>(offsets.size()));
+}
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 1000000);
+  constexpr std::size_t length = 24;  // beyond the small string buffer
+  constexpr std::size_t keys = 1000;
+
+  // A receive buffer holding the keys back to back
+  std::string wire;
+  for (std::size_t i = 0; i < keys; ++i) {
+    std::string k = "tag-key-" + std::to_string(i);
+    k.resize(length, '.');
+    wire += k;
+  }
+  std::vector<std::size_t> offsets;
+  for (std::size_t i = 0; i < n; ++i) offsets.push_back((i * 7919 % keys) * length);
+
+  std::unordered_map<tag_key, int> node;
+  opaque::flat_map<tag_key, int> flat;
+  for (std::size_t i = 0; i < keys; ++i) {
+    const tag_key k(wire.data() + i * length, length);
+    node.emplace(k, 0);
+    flat.try_emplace(k, 0);
+  }
+
+  const auto owning = [](const char * p, std::size_t len) {
+    return tag_key(p, len);
+  };
+  const auto view = [](const char * p, std::size_t len) {
+    return tag_view(p, len);
+  };
+  run("unordered_map count, owning key", node, wire, offsets, length, owning);
+  run("unordered_map count, view"      , node, wire, offsets, length, view);
+  run("flat_map count, owning key"     , flat, wire, offsets, length, owning);
+  run("flat_map count, view"           , flat, wire, offsets, length, view);
+}
@@ -0,0 +1,319 @@
+#ifndef OPAQUE_EXPERIMENTAL_STRING_VIEW_TYPEDEF_HPP
+#define OPAQUE_EXPERIMENTAL_STRING_VIEW_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/storage.hpp"
+#include "opaque/hash.hpp"
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+namespace opaque {
+namespace experimental {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Read-only view of the characters of one particular string typedef
+///
+/// The view borrows the characters of an instance of O (a
+/// safer_string_typedef or string_typedef) without copying them.  It is a
+/// distinct opaque type for every O, so a view of one kind of string cannot
+/// be compared with another kind of string.  It can be created explicitly
+/// from a character range, such as bytes received from the network, which
+/// makes it suitable for allocation-free lookup of O keys.
+///
+/// It converts implicitly from O (and from nothing else), so a function
+/// taking a string_view_typedef<O> accepts either an O or a slice of a
+/// buffer, and never forces a caller to allocate.  The read-only members of
+/// safer_string_typedef are provided, with substr returning a view, and
+/// comparison and hashing agree with O.
+///
+/// As with std::string_view, the viewed characters must outlive the view.
+///
+/// Template arguments:
+///  -# O : The owning string typedef
+///
+template <typename O>
+struct string_view_typedef : opaque_storage<
+    std::basic_string_view<typename O::value_type, typename O::traits_type>,
+    string_view_typedef<O>> {
+private:
+  using base = opaque_storage<
+    std::basic_string_view<typename O::value_type, typename O::traits_type>,
+    string_view_typedef<O>>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using owner_type = O;
+  using base::value;
+
+  using traits_type     = typename underlying_type::traits_type;
+  using value_type      = typename underlying_type::value_type;
+  using size_type       = typename underlying_type::size_type;
+  using difference_type = typename underlying_type::difference_type;
+  using const_reference = typename underlying_type::const_reference;
+  using const_pointer   = typename underlying_type::const_pointer;
+  using const_iterator  = typename underlying_type::const_iterator;
+  using const_reverse_iterator =
+    typename underlying_type::const_reverse_iterator;
+  static constexpr size_type npos = underlying_type::npos;
+
+  constexpr string_view_typedef() noexcept = default;
+
+  explicit constexpr string_view_typedef(underlying_type sv) noexcept
+    : base(sv) { }
+
+  explicit constexpr string_view_typedef(const value_type * s, size_type n)
+    noexcept
+    : base(s, n) { }
+
+  constexpr string_view_typedef(const owner_type& owner) noexcept
+    : base(underlying_type(owner.value)) { }
+
+  constexpr const_iterator          begin() const noexcept { return value.begin();   }
+  constexpr const_iterator            end() const noexcept { return value.end();     }
+  constexpr const_iterator         cbegin() const noexcept { return value.cbegin();  }
+  constexpr const_iterator           cend() const noexcept { return value.cend();    }
+  constexpr const_reverse_iterator rbegin() const noexcept { return value.rbegin();  }
+  constexpr const_reverse_iterator   rend() const noexcept { return value.rend();    }
+  constexpr const_pointer            data() const noexcept { return value.data();    }
+  constexpr size_type                size() const noexcept { return value.size();    }
+  constexpr size_type              length() const noexcept { return value.length();  }
+  constexpr bool                    empty() const noexcept { return value.empty();   }
+
+  constexpr const_reference operator[](size_type pos) const { return value[pos]; }
+  constexpr const_reference at(size_type n)           const { return value.at(n); }
+  constexpr const_reference front() const { return value.front(); }
+  constexpr const_reference back()  const { return value.back(); }
+
+  constexpr void remove_prefix(size_type n) { value.remove_prefix(n); }
+  constexpr void remove_suffix(size_type n) { value.remove_suffix(n); }
+
+  constexpr size_type find (string_view_typedef str, size_type pos = 0) const noexcept {
+    return value.find(str.value, pos);
+  }
+  constexpr size_type find (const value_type* s, size_type pos, size_type n) const {
+    return value.find(s, pos, n);
+  }
+  constexpr size_type find (const value_type* s, size_type pos = 0) const {
+    return value.find(s, pos);
+  }
+  constexpr size_type find (value_type c, size_type pos = 0) const noexcept {
+    return value.find(c, pos);
+  }
+  constexpr size_type rfind(string_view_typedef str, size_type pos = npos) const noexcept {
+    return value.rfind(str.value, pos);
+  }
+  constexpr size_type rfind(const value_type* s, size_type pos, size_type n) const {
+    return value.rfind(s, pos, n);
+  }
+  constexpr size_type rfind(const value_type* s, size_type pos = npos) const {
+    return value.rfind(s, pos);
+  }
+  constexpr size_type rfind(value_type c, size_type pos = npos) const noexcept {
+    return value.rfind(c, pos);
+  }
+
+  constexpr size_type find_first_of(string_view_typedef str, size_type pos = 0) const noexcept {
+    return value.find_first_of(str.value, pos);
+  }
+  constexpr size_type find_first_of(const value_type* s, size_type pos, size_type n) const {
+    return value.find_first_of(s, pos, n);
+  }
+  constexpr size_type find_first_of(const value_type* s, size_type pos = 0) const {
+    return value.find_first_of(s, pos);
+  }
+  constexpr size_type find_first_of(value_type c, size_type pos = 0) const noexcept {
+    return value.find_first_of(c, pos);
+  }
+  constexpr size_type find_last_of (string_view_typedef str, size_type pos = npos) const noexcept {
+    return value.find_last_of(str.value, pos);
+  }
+  constexpr size_type find_last_of (const value_type* s, size_type pos, size_type n) const {
+    return value.find_last_of(s, pos, n);
+  }
+  constexpr size_type find_last_of (const value_type* s, size_type pos = npos) const {
+    return value.find_last_of(s, pos);
+  }
+  constexpr size_type find_last_of (value_type c, size_type pos = npos) const noexcept {
+    return value.find_last_of(c, pos);
+  }
+
+  constexpr size_type find_first_not_of(string_view_typedef str, size_type pos = 0) const noexcept {
+    return value.find_first_not_of(str.value, pos);
+  }
+  constexpr size_type find_first_not_of(const value_type* s, size_type pos, size_type n) const {
+    return value.find_first_not_of(s, pos, n);
+  }
+  constexpr size_type find_first_not_of(const value_type* s, size_type pos = 0) const {
+    return value.find_first_not_of(s, pos);
+  }
+  constexpr size_type find_first_not_of(value_type c, size_type pos = 0) const noexcept {
+    return value.find_first_not_of(c, pos);
+  }
+  constexpr size_type find_last_not_of (string_view_typedef str, size_type pos = npos) const noexcept {
+    return value.find_last_not_of(str.value, pos);
+  }
+  constexpr size_type find_last_not_of (const value_type* s, size_type pos, size_type n) const {
+    return value.find_last_not_of(s, pos, n);
+  }
+  constexpr size_type find_last_not_of (const value_type* s, size_type pos = npos) const {
+    return value.find_last_not_of(s, pos);
+  }
+  constexpr size_type find_last_not_of (value_type c, size_type pos = npos) const noexcept {
+    return value.find_last_not_of(c, pos);
+  }
+
+  /// A view of part of the viewed characters; throws std::out_of_range
+  constexpr string_view_typedef substr(size_type pos = 0, size_type n = npos) const {
+    return string_view_typedef(value.substr(pos, n));
+  }
+
+  constexpr int compare(string_view_typedef str) const noexcept {
+    return value.compare(str.value);
+  }
+  constexpr int compare(size_type pos1, size_type n1, string_view_typedef str) const {
+    return value.compare(pos1, n1, str.value);
+  }
+  constexpr int compare(size_type pos1, size_type n1, string_view_typedef str,
+      size_type pos2, size_type n2) const {
+    return value.compare(pos1, n1, str.value, pos2, n2);
+  }
+  constexpr int compare(const value_type* s) const {
+    return value.compare(s);
+  }
+  constexpr int compare(size_type pos1, size_type n1, const value_type* s) const {
+    return value.compare(pos1, n1, s);
+  }
+  constexpr int compare(size_type pos1, size_type n1, const value_type* s,
+      size_type n2) const {
+    return value.compare(pos1, n1, s, n2);
+  }
+
+  constexpr bool starts_with(string_view_typedef str) const noexcept {
+    return value.starts_with(str.value);
+  }
+  constexpr bool starts_with(value_type c) const noexcept {
+    return value.starts_with(c);
+  }
+  constexpr bool ends_with(string_view_typedef str) const noexcept {
+    return value.ends_with(str.value);
+  }
+  constexpr bool ends_with(value_type c) const noexcept {
+    return value.ends_with(c);
+  }
+
+  /// Copy the viewed characters into a new owning string
+  explicit operator owner_type() const {
+    return owner_type(typename owner_type::underlying_type(value));
+  }
+
+  friend constexpr bool operator==(const string_view_typedef& v,
+      const owner_type& o) noexcept {
+    return v.value == underlying_type(o.value);
+  }
+  friend constexpr auto operator<=>(const string_view_typedef& v,
+      const owner_type& o) noexcept {
+    return v.value <=> underlying_type(o.value);
+  }
+};
+
+/// @}
+
+}
+}
+
+///
+/// Hash a string_view_typedef as its owner hashes it, when the owner's
+/// std::hash is transparent (see OPAQUE_HASHABLE_TRANSPARENT)
+///
+template <typename O>
+  requires requires (const opaque::experimental::string_view_typedef<O>& v) {
+    std::hash<O>{}(v);
+  }
+struct std::hash<opaque::experimental::string_view_typedef<O>> {
+  using argument_type = opaque::experimental::string_view_typedef<O>;
+  using result_type = std::size_t;
+  static constexpr bool avalanching = opaque::detail::avalanching_hash<hash<O>>;
+  result_type operator()(const argument_type& key) const {
+    return std::hash<O>{}(key);
+  }
+};
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Create transparent std::hash and std::equal_to specializations for a
+/// string typedef
+///
+/// Besides the string typedef itself, both accept its string_view_typedef,
+/// so that std::unordered_map::find (and opaque::flat_map::find) can look up
+/// a key from borrowed characters without constructing an owning string.
+/// Views hash identically to the strings they view, under any policy.
+///
+/// The optional second argument names a hash policy, as for
+/// OPAQUE_HASHABLE.
+///
+/// This macro must be used outside any namespace, because it creates
+/// specializations in std.
+///
+#define OPAQUE_HASHABLE_TRANSPARENT(name, ...) \
+namespace std {\
+  template <> struct hash<name> {\
+    using argument_type = typename name::opaque_type;\
+    using view_type = opaque::experimental::string_view_typedef<name>;\
+    using result_type = size_t;\
+    using is_transparent = void;\
+    using policy_type = opaque::hash_policy::select<__VA_ARGS__>;\
+    static constexpr bool avalanching = policy_type::avalanching;\
+    result_type operator()(const argument_type& key) const {\
+      return policy_type{}(key.value, 0);\
+    }\
+    result_type operator()(const view_type& key) const {\
+      return policy_type{}(key.value, 0);\
+    }\
+  };\
+  template <> struct equal_to<name> {\
+    using is_transparent = void;\
+    using view_type = opaque::experimental::string_view_typedef<name>;\
+    bool operator()(const name& a, const name& b) const { return a == b; }\
+    bool operator()(const name& a, const view_type& b) const { return b == a; }\
+    bool operator()(const view_type& a, const name& b) const { return a == b; }\
+    bool operator()(const view_type& a, const view_type& b) const {\
+      return a == b;\
+    }\
+  };\
+}
+
+/// @}
+
+#endif
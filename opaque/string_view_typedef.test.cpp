@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/string_view_typedef.hpp"
+#include "opaque/string_typedef.hpp"
+#include "opaque/flat_map.hpp"
+#include "arrtest/arrtest.hpp"
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+UNIT_TEST_MAIN
+
+struct symbol : opaque::experimental::string_typedef<std::string, symbol> {
+  using base = opaque::experimental::string_typedef<std::string, symbol>;
+  using base::base;
+};
+
+struct venue : opaque::experimental::safer_string_typedef<std::string, venue> {
+  using base = opaque::experimental::safer_string_typedef<std::string, venue>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE_TRANSPARENT(symbol)
+OPAQUE_HASHABLE_TRANSPARENT(venue, opaque::hash_policy::seeded<>)
+
+using symbol_view = opaque::experimental::string_view_typedef<symbol>;
+using venue_view  = opaque::experimental::string_view_typedef<venue>;
+
+static_assert(not std::is_convertible_v<const char *, symbol_view>);
+static_assert(not std::is_convertible_v<std::string, symbol_view>);
+static_assert(not std::is_convertible_v<std::string_view, symbol_view>);
+static_assert(std::is_convertible_v<symbol, symbol_view>);
+static_assert(not std::is_convertible_v<venue, symbol_view>);
+static_assert(not std::is_convertible_v<symbol_view, symbol>);
+static_assert(not std::is_constructible_v<symbol_view, venue>);
+static_assert(not std::is_constructible_v<venue_view, symbol_view>);
+
+TEST(view) {
+  const symbol s("IBM");
+  const symbol_view v(s);
+  CHECK_EQUAL(s.data(), v.data());
+  CHECK_EQUAL(3u, v.size());
+  CHECK_EQUAL(true, v == s);
+  CHECK_EQUAL(true, s == v);
+  CHECK_EQUAL(true, v < symbol("MSFT"));
+  CHECK_EQUAL(true, static_cast<symbol>(v) == s);
+}
+
+TEST(hash_agrees) {
+  const venue o("XNAS");
+  const char wire[] = "XNASXNYS";
+  const venue_view v(wire, 4);
+  CHECK_EQUAL(std::hash<venue>{}(o), std::hash<venue>{}(v));
+  CHECK_EQUAL(true, std::equal_to<venue>{}(o, v));
+}
+
+TEST(unordered_map_find) {
+  std::unordered_map<symbol, int> m;
+  m.emplace(symbol("a fairly long symbol name, beyond SSO"), 1);
+  const std::string wire = "a fairly long symbol name, beyond SSO";
+  auto it = m.find(symbol_view(wire.data(), wire.size()));
+  CHECK_EQUAL(true, it != m.end());
+  CHECK_EQUAL(false, m.contains(symbol_view("nope", 4)));
+}
+
+TEST(flat_map_find) {
+  opaque::flat_map<venue, int> m;
+  m[venue("XNAS")] = 1;
+  m[venue("XNYS")] = 2;
+  const char wire[] = "XNYS";
+  CHECK_EQUAL(2, m.find(venue_view(wire, 4))->second);
+  CHECK_EQUAL(false, m.contains(venue_view(wire, 3)));
+}
+
+static std::size_t length_of(symbol_view v) { return v.size(); }
+
+TEST(implicit_from_owner) {
+  const symbol s("AAPL");
+  CHECK_EQUAL(4u, length_of(s));
+  const char wire[] = "AAPL.OQ";
+  CHECK_EQUAL(7u, length_of(symbol_view(wire, 7)));
+}
+
+TEST(read_only_members) {
+  const symbol s("BRK.B.XNYS");
+  const symbol_view v(s);
+  CHECK_EQUAL(3u, v.find('.'));
+  CHECK_EQUAL(5u, v.rfind('.'));
+  CHECK_EQUAL(3u, v.find_first_of(".,"));
+  CHECK_EQUAL(5u, v.find_last_of("."));
+  CHECK_EQUAL(3u, v.find_first_not_of("BRK"));
+  CHECK_EQUAL(symbol_view::npos, v.find("XLON"));
+  CHECK_EQUAL(6u, v.find(symbol("XNYS")));
+  const symbol_view sub = v.substr(6);
+  CHECK_EQUAL(true, sub == symbol("XNYS"));
+  CHECK_EQUAL(v.data() + 6, sub.data());
+  CHECK_EQUAL(0, v.compare(s));
+  CHECK(v.compare(symbol("BRK.A")) > 0);
+  CHECK(v.compare(0, 3, "BRK") == 0);
+  CHECK_EQUAL(true, v.starts_with(symbol("BRK")));
+  CHECK_EQUAL(true, v.ends_with('S'));
+  CHECK_EQUAL('B', v.front());
+  CHECK_EQUAL('.', v[3]);
+  try {
+    (void)v.substr(11);
+    CHECK_CATCH(std::out_of_range, e);
+  }
+  symbol_view w = v;
+  w.remove_prefix(6);
+  w.remove_suffix(2);
+  CHECK_EQUAL(true, w == symbol("XN"));
+}
+
+TEST(view_hash_matches_owner) {
+  const venue o("XLON");
+  const venue_view v(o);
+  CHECK_EQUAL(std::hash<venue>{}(o), std::hash<venue_view>{}(v));
+  CHECK_EQUAL(std::hash<symbol>{}(symbol("X")),
+              std::hash<symbol_view>{}(symbol_view("X", 1)));
+}
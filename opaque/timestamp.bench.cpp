@@ -0,0 +1,54 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/timestamp.hpp"
+#include "opaque/stopwatch.bench.hpp"
+#include <chrono>
+#include <cstdio>
+
+int main(int argc, char * argv[]) {
+  const std::size_t n = bench_size(argc, argv, 20000000);
+  opaque::tsc_clock::calibrate();
+  std::printf("source: %s\n",
+      opaque::tsc_clock::active_source() == opaque::tsc_clock::source::tsc ?
+      "tsc" : "steady_clock");
+
+  measure("steady_clock::now", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      keep(std::chrono::steady_clock::now());
+    }
+  });
+  measure("tsc_clock::now", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) keep(opaque::tsc_clock::now());
+  });
+  measure("tsc_clock::now_ordered", n, [&] {
+    for (std::size_t i = 0; i < n; ++i) {
+      keep(opaque::tsc_clock::now_ordered());
+    }
+  });
+}
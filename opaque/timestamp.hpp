@@ -0,0 +1,268 @@
+#ifndef OPAQUE_TIMESTAMP_HPP
+#define OPAQUE_TIMESTAMP_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/position_typedef.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#if defined(__x86_64__) || defined(__i386__)
+#if defined(__GNUC__) || defined(__clang__)
+#include <cpuid.h>
+#include <x86intrin.h>
+#define OPAQUE_HAS_TSC 1
+#endif
+#endif
+
+namespace opaque {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Signed duration in nanoseconds
+///
+/// Converts explicitly to and from any std::chrono::duration; conversion to
+/// and from std::chrono::nanoseconds is free.
+///
+struct duration : numeric_typedef<std::int64_t, duration> {
+  using base = numeric_typedef<std::int64_t, duration>;
+
+  explicit duration() = default;
+
+  explicit constexpr duration(std::int64_t ns) noexcept : base(ns) { }
+
+  template <typename Rep, typename Period>
+  explicit constexpr duration(std::chrono::duration<Rep, Period> d) noexcept
+    : base(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count())
+    { }
+
+  constexpr std::chrono::nanoseconds to_chrono() const noexcept {
+    return std::chrono::nanoseconds(value);
+  }
+
+  template <typename Rep, typename Period>
+  explicit constexpr operator std::chrono::duration<Rep, Period>() const
+    noexcept {
+    return std::chrono::duration_cast<std::chrono::duration<Rep, Period>>(
+        to_chrono());
+  }
+};
+
+///
+/// Point in time, in nanoseconds on the std::chrono::steady_clock timeline
+///
+/// timestamp - timestamp gives a duration, timestamp + duration gives a
+/// timestamp, and timestamp + timestamp does not compile.
+///
+struct timestamp : position_typedef<duration, timestamp> {
+  using base = position_typedef<duration, timestamp>;
+  using clock_time_point = std::chrono::steady_clock::time_point;
+
+  explicit timestamp() = default;
+
+  explicit constexpr timestamp(std::int64_t ns) noexcept : base(ns) { }
+
+  explicit constexpr timestamp(clock_time_point t) noexcept
+    : base(std::chrono::duration_cast<std::chrono::nanoseconds>(
+          t.time_since_epoch()).count())
+    { }
+
+  constexpr clock_time_point to_chrono() const noexcept {
+    return clock_time_point(
+        std::chrono::duration_cast<clock_time_point::duration>(
+          std::chrono::nanoseconds(value)));
+  }
+
+  explicit constexpr operator clock_time_point() const noexcept {
+    return to_chrono();
+  }
+};
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+///
+/// Linear map from TSC ticks to steady_clock nanoseconds
+///
+/// The rate is held as 32.32 fixed point, and the product is split so that
+/// it cannot overflow for any realistic uptime.  Readings before the base,
+/// which skew between cores or an unordered read can produce, map to times
+/// before base_ns rather than wrapping.
+///
+struct tsc_calibration {
+  bool          usable = false;
+  std::uint64_t base_ticks = 0;
+  std::int64_t  base_ns = 0;
+  std::uint64_t ns_per_tick_q32 = 0;
+
+  constexpr std::int64_t to_ns(std::uint64_t ticks) const noexcept {
+    if (ticks < base_ticks) return base_ns - scale(base_ticks - ticks);
+    return base_ns + scale(ticks - base_ticks);
+  }
+
+  constexpr std::int64_t scale(std::uint64_t d) const noexcept {
+    const std::uint64_t hi = (d >> 32) * ns_per_tick_q32;
+    const std::uint64_t lo = ((d & 0xffffffffu) * ns_per_tick_q32) >> 32;
+    return static_cast<std::int64_t>(hi + lo);
+  }
+};
+
+#if defined(OPAQUE_HAS_TSC)
+
+/// Whether the TSC runs at a constant rate in all power states
+inline bool invariant_tsc() noexcept {
+  unsigned a = 0, b = 0, c = 0, d = 0;
+  if (not __get_cpuid(0x80000000u, &a, &b, &c, &d) or a < 0x80000007u) {
+    return false;
+  }
+  __get_cpuid(0x80000007u, &a, &b, &c, &d);
+  return (d >> 8) & 1;
+}
+
+inline tsc_calibration calibrate_tsc(std::chrono::nanoseconds interval) {
+  using sc = std::chrono::steady_clock;
+  tsc_calibration c;
+  if (not invariant_tsc()) return c;
+  const auto t0 = sc::now();
+  const std::uint64_t k0 = __rdtsc();
+  while (sc::now() - t0 < interval) std::this_thread::yield();
+  const std::uint64_t k1 = __rdtsc();
+  const auto t1 = sc::now();
+  if (k1 <= k0) return c;
+  const double ns = static_cast<double>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count());
+  const double rate = ns / static_cast<double>(k1 - k0);
+  c.ns_per_tick_q32 = static_cast<std::uint64_t>(rate * 4294967296.0);
+  c.base_ticks = k1;
+  c.base_ns = timestamp(t1).value;
+  c.usable = c.ns_per_tick_q32 != 0;
+  return c;
+}
+
+#endif
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Low-overhead clock producing opaque timestamps
+///
+/// Where the processor has an invariant time stamp counter, now() reads it
+/// without a system call and scales it to the steady_clock timeline, so its
+/// timestamps mix freely with those from std::chrono::steady_clock.
+/// Otherwise now() reads steady_clock, which is CLOCK_MONOTONIC on POSIX.
+///
+/// The counter is calibrated against steady_clock over 10 ms the first time
+/// the clock is used; call calibrate() at startup to choose when that cost
+/// is paid.  Calibration error is proportional to elapsed time, a few parts
+/// per million, so the TSC path suits measuring intervals.
+///
+/// Each calibration is an immutable object published through an atomic
+/// pointer, so calibrate() may run while other threads read the clock.
+/// Superseded calibrations are never freed, since readers may still hold
+/// them; recalibrate rarely.
+///
+class tsc_clock {
+public:
+  enum class source { tsc, steady_clock };
+
+  /// Calibrate (or recalibrate) the counter over the given interval
+  static void calibrate(
+      std::chrono::nanoseconds interval = std::chrono::milliseconds(10)) {
+#if defined(OPAQUE_HAS_TSC)
+    state().store(new detail::tsc_calibration(detail::calibrate_tsc(interval)),
+        std::memory_order_release);
+#else
+    (void)interval;
+#endif
+  }
+
+  static source active_source() {
+    return current().usable ? source::tsc : source::steady_clock;
+  }
+
+  /// The current time
+  static timestamp now() noexcept {
+#if defined(OPAQUE_HAS_TSC)
+    const auto& c = current();
+    if (c.usable) return timestamp(c.to_ns(__rdtsc()));
+#endif
+    return timestamp(std::chrono::steady_clock::now());
+  }
+
+  ///
+  /// The current time, read after all earlier instructions complete
+  ///
+  /// Use this to end a measured interval, so the measured work cannot be
+  /// reordered past the reading.
+  ///
+  static timestamp now_ordered() noexcept {
+#if defined(OPAQUE_HAS_TSC)
+    const auto& c = current();
+    if (c.usable) {
+      unsigned aux;
+      return timestamp(c.to_ns(__rdtscp(&aux)));
+    }
+#endif
+    return timestamp(std::chrono::steady_clock::now());
+  }
+
+private:
+  using calibration_ptr = std::atomic<const detail::tsc_calibration *>;
+
+  static calibration_ptr& state() noexcept {
+#if defined(OPAQUE_HAS_TSC)
+    static calibration_ptr c{ new detail::tsc_calibration(
+        detail::calibrate_tsc(std::chrono::milliseconds(10))) };
+#else
+    static calibration_ptr c{ new detail::tsc_calibration };
+#endif
+    return c;
+  }
+
+  static const detail::tsc_calibration& current() noexcept {
+    return *state().load(std::memory_order_acquire);
+  }
+};
+
+/// @}
+
+}
+
+#endif
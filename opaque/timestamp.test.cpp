@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/timestamp.hpp"
+#include "arrtest/arrtest.hpp"
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <thread>
+#include <type_traits>
+
+UNIT_TEST_MAIN
+
+using opaque::duration;
+using opaque::timestamp;
+using opaque::tsc_clock;
+using namespace std::chrono_literals;
+
+template <typename A, typename B>
+concept addable = requires (A a, B b) { a + b; };
+
+static_assert(std::is_same_v<decltype(timestamp() - timestamp()), duration>);
+static_assert(std::is_same_v<decltype(timestamp() + duration()), timestamp>);
+static_assert(std::is_same_v<decltype(timestamp() - duration()), timestamp>);
+static_assert(not addable<timestamp, timestamp>);
+static_assert(not std::is_convertible_v<std::int64_t, duration>);
+static_assert(not std::is_convertible_v<duration, std::chrono::nanoseconds>);
+static_assert(not std::is_convertible_v<std::chrono::nanoseconds, duration>);
+static_assert(sizeof(duration) == sizeof(std::chrono::nanoseconds));
+static_assert(sizeof(timestamp) == sizeof(std::chrono::steady_clock::time_point));
+
+static_assert(duration(2us) == duration(2000));
+static_assert(duration(1500).to_chrono() == 1500ns);
+static_assert(std::chrono::microseconds(duration(2500)) == 2us);
+static_assert(timestamp(100) + duration(50) == timestamp(150));
+static_assert(timestamp(150) - timestamp(100) == duration(50));
+
+// Ticks read just before the base map to just before base_ns
+static_assert(opaque::detail::tsc_calibration{
+    true, 1000u, 5000000, std::uint64_t{3} << 31 }.to_ns(990u) == 4999985);
+static_assert(opaque::detail::tsc_calibration{
+    true, 1000u, 5000000, std::uint64_t{3} << 31 }.to_ns(1010u) == 5000015);
+
+TEST(ticks_before_base) {
+  const opaque::detail::tsc_calibration c{ true, 1u << 20, 1000000000,
+    std::uint64_t{1} << 32 };
+  CHECK_EQUAL(std::int64_t{1000000000}, c.to_ns(1u << 20));
+  CHECK_EQUAL(std::int64_t{999999999}, c.to_ns((1u << 20) - 1u));
+  CHECK_EQUAL(std::int64_t{1000000000 - (1 << 20)}, c.to_ns(0u));
+}
+
+TEST(chrono_round_trip) {
+  const auto t = std::chrono::steady_clock::now();
+  CHECK(timestamp(t).to_chrono() == t);
+  CHECK(std::chrono::steady_clock::time_point(timestamp(t)) == t);
+  CHECK_EQUAL(duration(3s).value, 3000000000);
+}
+
+TEST(matches_steady_clock) {
+  tsc_clock::calibrate();
+  for (int i = 0; i < 100; ++i) {
+    const timestamp before(std::chrono::steady_clock::now());
+    const timestamp t = tsc_clock::now();
+    const timestamp after(std::chrono::steady_clock::now());
+    // Generous slack for calibration error and descheduling
+    CHECK(t >= before - duration(1ms));
+    CHECK(t <= after + duration(1ms));
+  }
+}
+
+TEST(monotonic) {
+  timestamp last = tsc_clock::now_ordered();
+  for (int i = 0; i < 10000; ++i) {
+    const timestamp t = tsc_clock::now_ordered();
+    CHECK(t >= last);
+    last = t;
+  }
+}
+
+TEST(recalibrate_while_reading) {
+  std::atomic<bool> done{false};
+  std::atomic<int> reads{0};
+  std::thread reader([&] {
+    while (not done.load()) {
+      const timestamp t = tsc_clock::now();
+      if (t.value != 0) ++reads;
+    }
+  });
+  for (int i = 0; i < 3; ++i) tsc_clock::calibrate(1ms);
+  done = true;
+  reader.join();
+  CHECK(reads.load() > 0);
+  const auto gap = timestamp(std::chrono::steady_clock::now()) - tsc_clock::now();
+  CHECK(gap < duration(1ms));
+  CHECK(gap > duration(-1ms));
+}
+
+TEST(measures_sleep) {
+  const timestamp start = tsc_clock::now();
+  std::this_thread::sleep_for(20ms);
+  const duration d = tsc_clock::now_ordered() - start;
+  CHECK(d >= duration(19ms));
+  CHECK(d <= duration(2s));
+}